@@ -1,8 +1,18 @@
 #include <bgfx.h>
 #include <bgfxplatform.h>
+#include <bx/readerwriter.h>
 #include "bridge.h"
+#include "image.h"
 
 BGFX_C_API void bgfx_dbg_text_print(uint32_t x, uint32_t y, uint8_t attr, const char *text) {
 	bgfx::dbgTextPrintf(x, y, attr, "%s", text);
 }
 
+
+BGFX_C_API void bgfx_image_decode_to_bgra8(uint8_t* dst, const uint8_t* src, uint32_t width, uint32_t height, uint32_t pitch, uint8_t format, int ref) {
+	if (ref) {
+		bgfx::imageDecodeToBgra8Ref(dst, src, width, height, pitch, format);
+	} else {
+		bgfx::imageDecodeToBgra8(dst, src, width, height, pitch, format);
+	}
+}
@@ -15,6 +15,7 @@ import (
 	"fmt"
 	"io"
 	"reflect"
+	"runtime"
 	"unsafe"
 )
 
@@ -58,6 +59,32 @@ func Reset(width, height int, flags ResetFlags) {
 	C.bgfx_reset(C.uint32_t(width), C.uint32_t(height), C.uint32_t(flags))
 }
 
+type CaptureFormat uint32
+
+const (
+	CaptureFormatCallback CaptureFormat = iota
+	CaptureFormatY4m
+	CaptureFormatTga
+	CaptureFormatQoi
+)
+
+// SetCapture sets where frames captured with ResetCapture are written.
+// It's used by the next capture started after Frame. Frame number and
+// extension are appended to path for formats with a file per frame.
+// CaptureFormatCallback passes frames to the callback, and the capture
+// is ignored without one.
+func SetCapture(format CaptureFormat, path string) {
+	cpath := C.CString(path)
+	defer C.free(unsafe.Pointer(cpath))
+	C.bgfx_set_capture(C.bgfx_capture_format_t(format), cpath)
+}
+
+// CaptureNumDropped returns the number of frames dropped by the current
+// or last capture because writing couldn't keep up, as of the last Frame.
+func CaptureNumDropped() uint32 {
+	return uint32(C.bgfx_get_capture_num_dropped())
+}
+
 // Frame advances to the next frame. Returns the current frame number.
 func Frame() uint32 {
 	return uint32(C.bgfx_frame())
@@ -166,6 +193,7 @@ const (
 	CapsCompute
 	CapsFragmentOrdering
 	CapsSwapChain
+	CapsIndex32
 )
 
 type Capabilities struct {
@@ -255,6 +283,63 @@ func VertexUnpack(attrib Attrib, decl VertexDecl, slice interface{}, index int)
 	return
 }
 
+// VertexPackArray packs attrib of len(input)/num vertices from input,
+// num floats per vertex, into slice starting at vertex index.
+func VertexPackArray(input []float32, num int, normalized bool, attrib Attrib, decl VertexDecl, slice interface{}, index int) {
+	val := reflect.ValueOf(slice)
+	if val.Kind() != reflect.Slice {
+		panic(errors.New("bgfx: expected slice"))
+	}
+	if num < 1 || num > 255 {
+		panic(errors.New("bgfx: num out of range"))
+	}
+	count := len(input) / num
+	if (index+count)*decl.Stride() > val.Len()*int(val.Type().Elem().Size()) {
+		panic(errors.New("bgfx: slice too small"))
+	}
+	if count == 0 {
+		return
+	}
+	C.bgfx_vertex_pack_array(
+		(*C.float)(unsafe.Pointer(&input[0])),
+		C.uint8_t(num),
+		C._Bool(normalized),
+		C.bgfx_attrib_t(attrib),
+		&decl.decl,
+		unsafe.Pointer(val.Pointer()),
+		C.uint32_t(count),
+		C.uint32_t(index),
+	)
+}
+
+// VertexUnpackArray unpacks attrib of len(output)/num vertices from
+// slice starting at vertex index into output, num floats per vertex.
+func VertexUnpackArray(output []float32, num int, attrib Attrib, decl VertexDecl, slice interface{}, index int) {
+	val := reflect.ValueOf(slice)
+	if val.Kind() != reflect.Slice {
+		panic(errors.New("bgfx: expected slice"))
+	}
+	if num < 1 || num > 255 {
+		panic(errors.New("bgfx: num out of range"))
+	}
+	count := len(output) / num
+	if (index+count)*decl.Stride() > val.Len()*int(val.Type().Elem().Size()) {
+		panic(errors.New("bgfx: slice too small"))
+	}
+	if count == 0 {
+		return
+	}
+	C.bgfx_vertex_unpack_array(
+		(*C.float)(unsafe.Pointer(&output[0])),
+		C.uint8_t(num),
+		C.bgfx_attrib_t(attrib),
+		&decl.decl,
+		unsafe.Pointer(val.Pointer()),
+		C.uint32_t(count),
+		C.uint32_t(index),
+	)
+}
+
 func VertexConvert(destDecl, srcDecl VertexDecl, dest, src interface{}) {
 	destVal := reflect.ValueOf(dest)
 	srcVal := reflect.ValueOf(src)
@@ -273,6 +358,487 @@ func VertexConvert(destDecl, srcDecl VertexDecl, dest, src interface{}) {
 		&srcDecl.decl, srcPtr, C.uint32_t(srcVal.Len()))
 }
 
+// VertexQuantization dequantizes positions of quantized vertex stream,
+// position is position.xyz*Scale + Bias.
+type VertexQuantization struct {
+	Scale [3]float32
+	Bias  [3]float32
+}
+
+// QuantizeVertexDecl returns compact vertex declaration of decl for
+// QuantizeVertices.
+func QuantizeVertexDecl(decl VertexDecl) VertexDecl {
+	var dest VertexDecl
+	C.bgfx_quantize_vertex_decl(&dest.decl, &decl.decl)
+	return dest
+}
+
+// QuantizeVertices quantizes vertices of src to dest, destDecl must be
+// created with QuantizeVertexDecl from srcDecl.
+func QuantizeVertices(destDecl, srcDecl VertexDecl, dest, src interface{}) VertexQuantization {
+	destVal := reflect.ValueOf(dest)
+	srcVal := reflect.ValueOf(src)
+	switch {
+	case destVal.Kind() != reflect.Slice,
+		srcVal.Kind() != reflect.Slice:
+		panic(errors.New("bgfx: expected slice"))
+	case destVal.Len() != srcVal.Len():
+		panic(errors.New("bgfx: len(dest) != len(src)"))
+	case destDecl.Stride() != int(destVal.Type().Elem().Size()):
+		panic(errors.New("bgfx: stride != dest element size"))
+	case srcDecl.Stride() != int(srcVal.Type().Elem().Size()):
+		panic(errors.New("bgfx: stride != src element size"))
+	}
+	destPtr := unsafe.Pointer(destVal.Pointer())
+	srcPtr := unsafe.Pointer(srcVal.Pointer())
+	q := C.bgfx_quantize_vertices(&destDecl.decl, destPtr,
+		&srcDecl.decl, srcPtr, C.uint32_t(srcVal.Len()))
+	var result VertexQuantization
+	for ii := range result.Scale {
+		result.Scale[ii] = float32(q.scale[ii])
+		result.Bias[ii] = float32(q.bias[ii])
+	}
+	return result
+}
+
+// VertexBounds is bounding box and bounding sphere of vertex positions.
+// Sphere Center is same as bounding box center.
+type VertexBounds struct {
+	Min    [3]float32
+	Max    [3]float32
+	Center [3]float32
+	Radius float32
+}
+
+// CalcVertexBounds returns bounds of positions of vertices, which can be
+// of any attribute type. Bounds are zero when there are no positions.
+func CalcVertexBounds(decl VertexDecl, vertices interface{}) VertexBounds {
+	val := reflect.ValueOf(vertices)
+	switch {
+	case val.Kind() != reflect.Slice:
+		panic(errors.New("bgfx: expected slice"))
+	case decl.Stride() != int(val.Type().Elem().Size()):
+		panic(errors.New("bgfx: stride != vertices element size"))
+	}
+	b := C.bgfx_calc_vertex_bounds(&decl.decl, unsafe.Pointer(val.Pointer()), C.uint32_t(val.Len()))
+	var result VertexBounds
+	for ii := range result.Center {
+		result.Min[ii] = float32(b.min[ii])
+		result.Max[ii] = float32(b.max[ii])
+		result.Center[ii] = float32(b.center[ii])
+	}
+	result.Radius = float32(b.radius)
+	return result
+}
+
+// CalcTangents calculates tangent frames of triangle list indices from
+// positions, normals and AttribTexcoord0 of vertices, and writes them to
+// AttribTangent, with handedness in w, and AttribBitangent. Vertices are
+// unchanged if decl doesn't have all of them, except bitangent.
+func CalcTangents(vertices interface{}, decl VertexDecl, indices []uint16) {
+	val := reflect.ValueOf(vertices)
+	switch {
+	case val.Kind() != reflect.Slice:
+		panic(errors.New("bgfx: expected slice"))
+	case decl.Stride() != int(val.Type().Elem().Size()):
+		panic(errors.New("bgfx: stride != vertices element size"))
+	}
+	if val.Len() == 0 {
+		return
+	}
+	C.bgfx_calc_tangents(unsafe.Pointer(val.Pointer()), C.uint32_t(val.Len()), &decl.decl,
+		unsafe.Pointer(unsafe.SliceData(indices)), C.uint32_t(len(indices)), false)
+}
+
+// WeldVertices welds vertices of src within epsilon of each other, and
+// whose attribs are within epsilon per component. It returns index of
+// each vertex in compacted vertex stream, and number of unique vertices,
+// which are copied to dest unless it's nil.
+func WeldVertices(dest, src interface{}, decl VertexDecl, epsilon float32, attribs ...Attrib) ([]uint32, int) {
+	srcVal := reflect.ValueOf(src)
+	switch {
+	case srcVal.Kind() != reflect.Slice:
+		panic(errors.New("bgfx: expected slice"))
+	case decl.Stride() != int(srcVal.Type().Elem().Size()):
+		panic(errors.New("bgfx: stride != src element size"))
+	}
+	var destPtr unsafe.Pointer
+	if dest != nil {
+		destVal := reflect.ValueOf(dest)
+		switch {
+		case destVal.Kind() != reflect.Slice:
+			panic(errors.New("bgfx: expected slice"))
+		case destVal.Len() < srcVal.Len():
+			panic(errors.New("bgfx: len(dest) < len(src)"))
+		}
+		destPtr = unsafe.Pointer(destVal.Pointer())
+	}
+	remap := make([]uint32, srcVal.Len())
+	if len(remap) == 0 {
+		return remap, 0
+	}
+	cattribs := cAttribs(attribs)
+	num := C.bgfx_weld_vertices32((*C.uint32_t)(unsafe.Pointer(&remap[0])), destPtr,
+		&decl.decl, unsafe.Pointer(srcVal.Pointer()), C.uint32_t(len(remap)),
+		C.float(epsilon), &cattribs[0], C.uint8_t(len(attribs)))
+	return remap, int(num)
+}
+
+// VertexCacheMissRatio returns average cache miss ratio (ACMR) of triangle
+// list indices for FIFO vertex cache with cacheSize entries.
+func VertexCacheMissRatio(indices []uint16, cacheSize int) float32 {
+	if len(indices) == 0 {
+		return 0
+	}
+	return float32(C.bgfx_vertex_cache_miss_ratio(unsafe.Pointer(&indices[0]),
+		C.uint32_t(len(indices)), false, C.uint32_t(cacheSize)))
+}
+
+type MeshOptimizeStats struct {
+	ACMRBefore  float32
+	ACMRAfter   float32
+	NumVertices int
+}
+
+// OptimizeMesh reorders indices for vertex cache and overdraw, and
+// writes vertices of src to dest in order of first use, remapping indices
+// in place.
+func OptimizeMesh(dest, src interface{}, decl VertexDecl, indices []uint16, overdrawThreshold float32) MeshOptimizeStats {
+	destVal := reflect.ValueOf(dest)
+	srcVal := reflect.ValueOf(src)
+	switch {
+	case destVal.Kind() != reflect.Slice,
+		srcVal.Kind() != reflect.Slice:
+		panic(errors.New("bgfx: expected slice"))
+	case destVal.Len() < srcVal.Len():
+		panic(errors.New("bgfx: len(dest) < len(src)"))
+	case decl.Stride() != int(srcVal.Type().Elem().Size()):
+		panic(errors.New("bgfx: stride != src element size"))
+	}
+	if len(indices) == 0 {
+		return MeshOptimizeStats{}
+	}
+	stats := C.bgfx_optimize_mesh(unsafe.Pointer(destVal.Pointer()),
+		unsafe.Pointer(&indices[0]), C.uint32_t(len(indices)), false,
+		&decl.decl, unsafe.Pointer(srcVal.Pointer()), C.uint32_t(srcVal.Len()),
+		C.float(overdrawThreshold))
+	return MeshOptimizeStats{
+		ACMRBefore:  float32(stats.acmrBefore),
+		ACMRAfter:   float32(stats.acmrAfter),
+		NumVertices: int(stats.numVertices),
+	}
+}
+
+// Meshlet is range of triangle list indices, with bounding sphere and
+// normal cone for culling.
+type Meshlet struct {
+	StartIndex uint32
+	NumIndices uint32
+	Center     [3]float32
+	Radius     float32
+	ConeAxis   [3]float32
+	ConeCutoff float32
+}
+
+// BuildMeshlets partitions triangle list indices into meshlets with at
+// most maxVertices unique vertices and maxTriangles triangles. It returns
+// meshlets and indices reordered so that each meshlet is consecutive range
+// of indices.
+func BuildMeshlets(indices []uint16, decl VertexDecl, vertices interface{}, maxVertices, maxTriangles int) ([]Meshlet, []uint16) {
+	val := reflect.ValueOf(vertices)
+	switch {
+	case val.Kind() != reflect.Slice:
+		panic(errors.New("bgfx: expected slice"))
+	case decl.Stride() != int(val.Type().Elem().Size()):
+		panic(errors.New("bgfx: stride != vertices element size"))
+	case maxVertices < 3 || maxTriangles < 1:
+		panic(errors.New("bgfx: meshlet must fit at least one triangle"))
+	}
+	if len(indices) < 3 {
+		return nil, nil
+	}
+	meshlets := make([]Meshlet, len(indices)/3)
+	dst := make([]uint16, len(indices)/3*3)
+	num := C.bgfx_build_meshlets((*C.bgfx_meshlet_t)(unsafe.Pointer(&meshlets[0])),
+		unsafe.Pointer(&dst[0]), unsafe.Pointer(&indices[0]), C.uint32_t(len(indices)),
+		false, &decl.decl, unsafe.Pointer(val.Pointer()), C.uint32_t(val.Len()),
+		C.uint32_t(maxVertices), C.uint32_t(maxTriangles))
+	return meshlets[:num], dst
+}
+
+// CullMeshlets returns indices of meshlets visible with model view
+// projection matrix mtx. Meshlets facing away from eye in model space are
+// culled, unless eye is nil. It panics if any meshlet is out of indices
+// range.
+func CullMeshlets(meshlets []Meshlet, indices []uint16, mtx [16]float32, eye *[3]float32) []uint16 {
+	total := meshletIndices(meshlets, indices)
+	if total == 0 {
+		return nil
+	}
+	dst := make([]uint16, total)
+	num := C.bgfx_cull_meshlets(unsafe.Pointer(&dst[0]),
+		(*C.bgfx_meshlet_t)(unsafe.Pointer(&meshlets[0])), C.uint32_t(len(meshlets)),
+		unsafe.Pointer(&indices[0]), false, (*C.float)(unsafe.Pointer(&mtx[0])),
+		(*C.float)(unsafe.Pointer(eye)))
+	if num == 0 {
+		return nil
+	}
+	return dst[:num]
+}
+
+// meshletIndices returns total number of indices of meshlets, and panics
+// if any meshlet is out of indices range.
+func meshletIndices(meshlets []Meshlet, indices []uint16) int {
+	total := 0
+	for _, m := range meshlets {
+		if uint64(m.StartIndex)+uint64(m.NumIndices) > uint64(len(indices)) {
+			panic(errors.New("bgfx: meshlet out of indices range"))
+		}
+		total += int(m.NumIndices)
+	}
+	return total
+}
+
+// MeshGroup is range of triangle list indices with bounding sphere and
+// bounding box.
+type MeshGroup struct {
+	StartIndex uint32
+	NumIndices uint32
+	Center     [3]float32
+	Radius     float32
+	Min        [3]float32
+	Max        [3]float32
+}
+
+// MeshData is contents of mesh container. Indices32 is used instead of
+// Indices when it isn't nil. Groups, Lods and Meshlets are ranges of
+// indices, so indices of all LODs and meshlets are stored together.
+type MeshData struct {
+	Decl      VertexDecl
+	Vertices  []byte
+	Indices   []uint16
+	Indices32 []uint32
+	Groups    []MeshGroup
+	Lods      []MeshLod
+	Meshlets  []Meshlet
+}
+
+func pinSlice(pinner *runtime.Pinner, ptr unsafe.Pointer, num int) unsafe.Pointer {
+	if num == 0 {
+		return nil
+	}
+	pinner.Pin(ptr)
+	return ptr
+}
+
+// WriteMesh returns mesh container with contents of mesh. Only index
+// ranges of groups are used, bounds are computed from vertices. Mesh
+// without groups is written with single group of all indices.
+func WriteMesh(mesh MeshData) []byte {
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+
+	clods := make([]C.bgfx_mesh_lod_t, len(mesh.Lods))
+	for ii, lod := range mesh.Lods {
+		clods[ii].startIndex = C.uint32_t(lod.StartIndex)
+		clods[ii].numIndices = C.uint32_t(lod.NumIndices)
+		clods[ii].error = C.float(lod.Error)
+	}
+
+	var cmesh C.bgfx_mesh_data_t
+	cmesh.decl = mesh.Decl.decl
+	cmesh.vertices = pinSlice(&pinner, unsafe.Pointer(unsafe.SliceData(mesh.Vertices)), len(mesh.Vertices))
+	cmesh.numVertices = C.uint32_t(len(mesh.Vertices) / mesh.Decl.Stride())
+	if mesh.Indices32 != nil {
+		cmesh.indices = pinSlice(&pinner, unsafe.Pointer(unsafe.SliceData(mesh.Indices32)), len(mesh.Indices32))
+		cmesh.numIndices = C.uint32_t(len(mesh.Indices32))
+		cmesh.index32 = true
+	} else {
+		cmesh.indices = pinSlice(&pinner, unsafe.Pointer(unsafe.SliceData(mesh.Indices)), len(mesh.Indices))
+		cmesh.numIndices = C.uint32_t(len(mesh.Indices))
+	}
+	cmesh.groups = (*C.bgfx_mesh_group_t)(pinSlice(&pinner, unsafe.Pointer(unsafe.SliceData(mesh.Groups)), len(mesh.Groups)))
+	cmesh.numGroups = C.uint32_t(len(mesh.Groups))
+	cmesh.lods = (*C.bgfx_mesh_lod_t)(pinSlice(&pinner, unsafe.Pointer(unsafe.SliceData(clods)), len(clods)))
+	cmesh.numLods = C.uint32_t(len(clods))
+	cmesh.meshlets = (*C.bgfx_meshlet_t)(pinSlice(&pinner, unsafe.Pointer(unsafe.SliceData(mesh.Meshlets)), len(mesh.Meshlets)))
+	cmesh.numMeshlets = C.uint32_t(len(mesh.Meshlets))
+
+	size := C.bgfx_write_mesh(nil, 0, &cmesh)
+	if size == 0 {
+		return nil
+	}
+	data := make([]byte, size)
+	C.bgfx_write_mesh(unsafe.Pointer(&data[0]), size, &cmesh)
+	return data
+}
+
+func newMeshData(cmesh *C.bgfx_mesh_data_t) MeshData {
+	mesh := MeshData{Decl: VertexDecl{decl: cmesh.decl}}
+	mesh.Vertices = unsafe.Slice((*byte)(cmesh.vertices), int(cmesh.numVertices)*mesh.Decl.Stride())
+	if cmesh.index32 {
+		mesh.Indices32 = unsafe.Slice((*uint32)(cmesh.indices), cmesh.numIndices)
+	} else {
+		mesh.Indices = unsafe.Slice((*uint16)(cmesh.indices), cmesh.numIndices)
+	}
+	mesh.Groups = unsafe.Slice((*MeshGroup)(unsafe.Pointer(cmesh.groups)), cmesh.numGroups)
+	mesh.Lods = make([]MeshLod, cmesh.numLods)
+	for ii, lod := range unsafe.Slice(cmesh.lods, cmesh.numLods) {
+		mesh.Lods[ii] = MeshLod{
+			StartIndex: int(lod.startIndex),
+			NumIndices: int(lod.numIndices),
+			Error:      float32(lod.error),
+		}
+	}
+	mesh.Meshlets = unsafe.Slice((*Meshlet)(unsafe.Pointer(cmesh.meshlets)), cmesh.numMeshlets)
+	return mesh
+}
+
+// ParseMesh parses mesh container. Returned vertices, indices, groups and
+// meshlets point into data, nothing is copied. It returns false if data
+// isn't valid mesh container.
+func ParseMesh(data []byte) (MeshData, bool) {
+	if len(data) == 0 {
+		return MeshData{}, false
+	}
+	var cmesh C.bgfx_mesh_data_t
+	if !C.bgfx_parse_mesh(&cmesh, unsafe.Pointer(&data[0]), C.uint32_t(len(data))) {
+		return MeshData{}, false
+	}
+	return newMeshData(&cmesh), true
+}
+
+// Mesh is mesh loaded with LoadMesh. MeshData points into file mapping
+// and stays valid until DestroyMesh.
+type Mesh struct {
+	MeshData
+	VertexBuffer VertexBuffer
+	IndexBuffer  IndexBuffer
+	m            C.bgfx_mesh_t
+}
+
+// LoadMesh loads mesh container file. The file is memory mapped and
+// buffers are created from references into the mapping, instead of
+// being loaded and copied like CreateVertexBuffer data. It returns false
+// if the file can't be mapped or isn't valid mesh container.
+func LoadMesh(path string) (Mesh, bool) {
+	cpath := C.CString(path)
+	defer C.free(unsafe.Pointer(cpath))
+	var mesh Mesh
+	if !C.bgfx_load_mesh(&mesh.m, cpath) {
+		return Mesh{}, false
+	}
+	mesh.MeshData = newMeshData(&mesh.m.data)
+	mesh.VertexBuffer = VertexBuffer{h: mesh.m.vbh}
+	mesh.IndexBuffer = IndexBuffer{h: mesh.m.ibh}
+	return mesh, true
+}
+
+// DestroyMesh destroys mesh buffers and unmaps mesh file. Mesh is
+// cleared, so destroying it again does nothing.
+func DestroyMesh(mesh *Mesh) {
+	C.bgfx_destroy_mesh(&mesh.m)
+	mesh.MeshData = MeshData{}
+	mesh.VertexBuffer = VertexBuffer{h: mesh.m.vbh}
+	mesh.IndexBuffer = IndexBuffer{h: mesh.m.ibh}
+}
+
+func cAttribs(attribs []Attrib) []C.bgfx_attrib_t {
+	cattribs := make([]C.bgfx_attrib_t, len(attribs)+1)
+	for ii, attrib := range attribs {
+		cattribs[ii] = C.bgfx_attrib_t(attrib)
+	}
+	return cattribs
+}
+
+// SimplifyMesh simplifies triangle list indices towards targetIndices
+// indices, with error at most maxError relative to mesh size. Squared
+// difference of attribs is added to error. It returns simplified indices,
+// which reference subset of vertices, and resulting error.
+func SimplifyMesh(indices []uint16, decl VertexDecl, vertices interface{}, targetIndices int, maxError float32, attribs ...Attrib) ([]uint16, float32) {
+	val := reflect.ValueOf(vertices)
+	switch {
+	case val.Kind() != reflect.Slice:
+		panic(errors.New("bgfx: expected slice"))
+	case decl.Stride() != int(val.Type().Elem().Size()):
+		panic(errors.New("bgfx: stride != vertices element size"))
+	}
+	if len(indices) == 0 {
+		return nil, 0
+	}
+	dst := make([]uint16, len(indices))
+	cattribs := cAttribs(attribs)
+	var cerror C.float
+	num := C.bgfx_simplify_mesh(unsafe.Pointer(&dst[0]), unsafe.Pointer(&indices[0]),
+		C.uint32_t(len(indices)), false, &decl.decl, unsafe.Pointer(val.Pointer()),
+		C.uint32_t(val.Len()), C.uint32_t(targetIndices), C.float(maxError),
+		&cattribs[0], C.uint8_t(len(attribs)), &cerror)
+	return dst[:num], float32(cerror)
+}
+
+// MeshLod is level of detail of mesh, Error is relative to mesh size.
+type MeshLod struct {
+	StartIndex int
+	NumIndices int
+	Error      float32
+}
+
+// GenerateMeshLods generates up to maxLods LODs, each simplified to ratio
+// of previous LOD triangles. LOD 0 is original mesh. It returns indices of
+// all LODs and LODs sorted from most detailed.
+func GenerateMeshLods(indices []uint16, decl VertexDecl, vertices interface{}, maxLods int, ratio float32, attribs ...Attrib) ([]uint16, []MeshLod) {
+	val := reflect.ValueOf(vertices)
+	switch {
+	case val.Kind() != reflect.Slice:
+		panic(errors.New("bgfx: expected slice"))
+	case decl.Stride() != int(val.Type().Elem().Size()):
+		panic(errors.New("bgfx: stride != vertices element size"))
+	}
+	if len(indices) == 0 || maxLods <= 0 {
+		return nil, nil
+	}
+	if maxLods > 255 {
+		maxLods = 255
+	}
+	dst := make([]uint16, len(indices)*maxLods)
+	clods := make([]C.bgfx_mesh_lod_t, maxLods)
+	cattribs := cAttribs(attribs)
+	num := C.bgfx_generate_mesh_lods(&clods[0], C.uint8_t(maxLods),
+		unsafe.Pointer(&dst[0]), C.uint32_t(len(dst)), unsafe.Pointer(&indices[0]),
+		C.uint32_t(len(indices)), false, &decl.decl, unsafe.Pointer(val.Pointer()),
+		C.uint32_t(val.Len()), C.float(ratio), &cattribs[0], C.uint8_t(len(attribs)))
+	lods := make([]MeshLod, num)
+	for ii := range lods {
+		lods[ii] = MeshLod{
+			StartIndex: int(clods[ii].startIndex),
+			NumIndices: int(clods[ii].numIndices),
+			Error:      float32(clods[ii].error),
+		}
+	}
+	last := lods[len(lods)-1]
+	return dst[:last.StartIndex+last.NumIndices], lods
+}
+
+// SelectMeshLod returns least detailed LOD whose error is within
+// pixelError, when largest extent of mesh bounds is screenSize pixels on
+// screen.
+func SelectMeshLod(lods []MeshLod, screenSize, pixelError float32) int {
+	if len(lods) == 0 {
+		return 0
+	}
+	if len(lods) > 255 {
+		lods = lods[:255]
+	}
+	clods := make([]C.bgfx_mesh_lod_t, len(lods))
+	for ii, lod := range lods {
+		clods[ii].startIndex = C.uint32_t(lod.StartIndex)
+		clods[ii].numIndices = C.uint32_t(lod.NumIndices)
+		clods[ii].error = C.float(lod.Error)
+	}
+	return int(C.bgfx_select_mesh_lod(&clods[0], C.uint8_t(len(clods)),
+		C.float(screenSize), C.float(pixelError)))
+}
+
 type TextureFlags uint32
 
 const (
@@ -287,7 +853,11 @@ const (
 	TextureMagPoint
 	TextureMagAnisotropic
 	TextureMipPoint
+	TextureResize
 	TextureComputeWrite = 0x00100000
+	TextureAsync        = 0x00200000
+	TextureMipsSrgb     = 0x00400000
+	TextureStream       = 0x00800000
 )
 
 const (
@@ -377,6 +947,23 @@ func CreateTexture(data []byte, flags TextureFlags, skip uint8) (Texture, Textur
 	return Texture{h: h}, newTextureInfo(ti)
 }
 
+// CreateTextureFromFile creates texture from DDS, KTX or PVR file. The
+// file is memory mapped and read by the renderer in place, instead of
+// being loaded and copied like CreateTexture data. Returned texture is
+// invalid if the file can't be mapped.
+func CreateTextureFromFile(path string, flags TextureFlags, skip uint8) (Texture, TextureInfo) {
+	cpath := C.CString(path)
+	defer C.free(unsafe.Pointer(cpath))
+	var ti C.bgfx_texture_info_t
+	h := C.bgfx_create_texture_from_file(
+		cpath,
+		C.uint32_t(flags),
+		C.uint8_t(skip),
+		&ti,
+	)
+	return Texture{h: h}, newTextureInfo(ti)
+}
+
 func CreateTexture2D(width, height, numMips int, format TextureFormat, flags TextureFlags, data []byte) Texture {
 	var mem *C.bgfx_memory_t
 	if data != nil {
@@ -393,6 +980,28 @@ func CreateTexture2D(width, height, numMips int, format TextureFormat, flags Tex
 	return Texture{h: h}
 }
 
+// CreateTexture2DInfo creates 2D texture like CreateTexture2D, and
+// returns size of created texture. With TextureResize it can be smaller
+// than passed width and height, and texture updates must use returned
+// size.
+func CreateTexture2DInfo(width, height, numMips int, format TextureFormat, flags TextureFlags, data []byte) (Texture, TextureInfo) {
+	var mem *C.bgfx_memory_t
+	if data != nil {
+		mem = C.bgfx_copy(unsafe.Pointer(&data[0]), C.uint32_t(len(data)))
+	}
+	var ti C.bgfx_texture_info_t
+	h := C.bgfx_create_texture_2d_info(
+		C.uint16_t(width),
+		C.uint16_t(height),
+		C.uint8_t(numMips),
+		C.bgfx_texture_format_t(format),
+		C.uint32_t(flags),
+		mem,
+		&ti,
+	)
+	return Texture{h: h}, newTextureInfo(ti)
+}
+
 func CreateTexture3D(width, height, depth, numMips int, format TextureFormat, flags TextureFlags, data []byte) Texture {
 	var mem *C.bgfx_memory_t
 	if data != nil {
@@ -429,6 +1038,32 @@ func DestroyTexture(t Texture) {
 	C.bgfx_destroy_texture(t.h)
 }
 
+// IsTextureReady reports whether a texture created with TextureAsync
+// has been created by the render thread.
+func IsTextureReady(t Texture) bool {
+	return bool(C.bgfx_is_texture_ready(t.h))
+}
+
+// SetUploadBudget sets the per-frame budget for creating TextureAsync
+// textures, in bytes and microseconds.
+func SetUploadBudget(size, timeUs uint32) {
+	C.bgfx_set_upload_budget(C.uint32_t(size), C.uint32_t(timeUs))
+}
+
+// SetTexturePriority sets the priority of a texture created with
+// TextureStream. Textures used in the last frame are promoted one mip at
+// a time in order of priority. Streaming textures can't be updated.
+func SetTexturePriority(t Texture, priority uint8) {
+	C.bgfx_set_texture_priority(t.h, C.uint8_t(priority))
+}
+
+// SetTextureStreamingBudget sets the memory budget in bytes for
+// TextureStream textures. Least recently used textures are demoted to
+// stay within it.
+func SetTextureStreamingBudget(size uint32) {
+	C.bgfx_set_texture_streaming_budget(C.uint32_t(size))
+}
+
 func CalcTextureSize(width, height, depth, numMips int, format TextureFormat) TextureInfo {
 	var ti C.bgfx_texture_info_t
 	C.bgfx_calc_texture_size(
@@ -463,6 +1098,92 @@ func UpdateTextureCube(t Texture, side, mip, x, y, width, height int, data []byt
 	)
 }
 
+// Atlas packs many small images into a single texture. Pixels are kept
+// in a CPU copy and changes are uploaded on Update.
+type Atlas struct {
+	a *C.bgfx_atlas_t
+}
+
+// AtlasRegion identifies an image added to an Atlas.
+type AtlasRegion uint32
+
+const InvalidAtlasRegion AtlasRegion = 0xffffffff
+
+// NewAtlas creates a size x size atlas texture. Padding pixels are left
+// empty around each region to avoid filtering bleed.
+func NewAtlas(size int, format TextureFormat, flags TextureFlags, maxRegions int, padding uint8) *Atlas {
+	return &Atlas{
+		a: C.bgfx_create_atlas(
+			C.uint16_t(size),
+			C.bgfx_texture_format_t(format),
+			C.uint32_t(flags),
+			C.uint16_t(maxRegions),
+			C.uint8_t(padding),
+		),
+	}
+}
+
+// Destroy destroys the atlas and its texture.
+func (a *Atlas) Destroy() {
+	C.bgfx_destroy_atlas(a.a)
+	a.a = nil
+}
+
+// Add copies an image into the atlas. When the atlas is full it is
+// defragmented, and if that doesn't help least recently used evictable
+// regions not touched this frame are evicted. Returns InvalidAtlasRegion
+// if the image doesn't fit.
+func (a *Atlas) Add(width, height int, data []byte, pitch int, evictable bool) AtlasRegion {
+	if pitch == 0 {
+		pitch = 0xffff
+	}
+	return AtlasRegion(C.bgfx_atlas_add(
+		a.a,
+		C.uint16_t(width),
+		C.uint16_t(height),
+		unsafe.Pointer(&data[0]),
+		C.uint16_t(pitch),
+		C.bool(evictable),
+	))
+}
+
+func (a *Atlas) Remove(r AtlasRegion) {
+	C.bgfx_atlas_remove(a.a, C.uint32_t(r))
+}
+
+// Touch marks region as used in the current frame.
+func (a *Atlas) Touch(r AtlasRegion) {
+	C.bgfx_atlas_touch(a.a, C.uint32_t(r))
+}
+
+// IsValid reports whether region was not removed or evicted.
+func (a *Atlas) IsValid(r AtlasRegion) bool {
+	return bool(C.bgfx_atlas_is_valid(a.a, C.uint32_t(r)))
+}
+
+// UV returns normalized texture coordinates of region. Regions move when
+// the atlas is defragmented, so query them when drawing.
+func (a *Atlas) UV(r AtlasRegion) (u0, v0, u1, v1 float32) {
+	var uv [4]C.float
+	C.bgfx_atlas_get_uv(a.a, C.uint32_t(r), &uv[0])
+	return float32(uv[0]), float32(uv[1]), float32(uv[2]), float32(uv[3])
+}
+
+func (a *Atlas) Texture() Texture {
+	return Texture{h: C.bgfx_atlas_get_texture(a.a)}
+}
+
+// Update uploads changes made since the last update.
+func (a *Atlas) Update() {
+	C.bgfx_atlas_update(a.a)
+}
+
+// Defragment repacks all regions. Returns false if they don't fit in the
+// new order, in which case the atlas is unchanged.
+func (a *Atlas) Defragment() bool {
+	return bool(C.bgfx_atlas_defragment(a.a))
+}
+
 type FrameBuffer struct {
 	h C.bgfx_frame_buffer_handle_t
 }
@@ -593,6 +1314,18 @@ func CreateIndexBuffer(data []uint16) IndexBuffer {
 		h: C.bgfx_create_index_buffer(
 			// to keep things simple for now, we'll just copy
 			C.bgfx_copy(unsafe.Pointer(&data[0]), C.uint32_t(len(data)*2)),
+			C.BGFX_BUFFER_NONE,
+		),
+	}
+}
+
+// CreateIndexBuffer32 creates index buffer with 32-bit indices, which
+// requires CapsIndex32.
+func CreateIndexBuffer32(data []uint32) IndexBuffer {
+	return IndexBuffer{
+		h: C.bgfx_create_index_buffer(
+			C.bgfx_copy(unsafe.Pointer(&data[0]), C.uint32_t(len(data)*4)),
+			C.BGFX_BUFFER_INDEX32,
 		),
 	}
 }
@@ -627,20 +1360,55 @@ type TransientIndexBuffer struct {
 	tib C.bgfx_transient_index_buffer_t
 }
 
-func AllocTransientIndexBuffer(buf *[]uint16, num int) TransientIndexBuffer {
+func allocTransientIndexBuffer(buf unsafe.Pointer, num int, index32 bool) TransientIndexBuffer {
 	var tib TransientIndexBuffer
 	C.bgfx_alloc_transient_index_buffer(
 		&tib.tib,
 		C.uint32_t(num),
+		C.bool(index32),
 	)
-	slice := (*reflect.SliceHeader)(unsafe.Pointer(buf))
+	slice := (*reflect.SliceHeader)(buf)
 	slice.Data = uintptr(unsafe.Pointer(tib.tib.data))
 	slice.Len = num
 	slice.Cap = num
 	return tib
 }
 
-func AllocTransientBuffers(verts interface{}, idxs *[]uint16, decl VertexDecl, numVerts, numIndices int) (tvb TransientVertexBuffer, tib TransientIndexBuffer, ok bool) {
+func AllocTransientIndexBuffer(buf *[]uint16, num int) TransientIndexBuffer {
+	return allocTransientIndexBuffer(unsafe.Pointer(buf), num, false)
+}
+
+// AllocTransientIndexBuffer32 allocates transient index buffer with 32-bit
+// indices, which requires CapsIndex32.
+func AllocTransientIndexBuffer32(buf *[]uint32, num int) TransientIndexBuffer {
+	return allocTransientIndexBuffer(unsafe.Pointer(buf), num, true)
+}
+
+// AllocTransientMeshlets allocates transient index buffer with indices
+// of meshlets visible with model view projection matrix mtx. Meshlets
+// facing away from eye in model space are culled, unless eye is nil. It
+// returns false when no meshlet is visible or transient index buffer is
+// full, and panics if any meshlet is out of indices range.
+func AllocTransientMeshlets(buf *[]uint16, meshlets []Meshlet, indices []uint16, mtx [16]float32, eye *[3]float32) (TransientIndexBuffer, bool) {
+	var tib TransientIndexBuffer
+	if meshletIndices(meshlets, indices) == 0 {
+		return tib, false
+	}
+	num := C.bgfx_alloc_transient_meshlets(&tib.tib,
+		(*C.bgfx_meshlet_t)(unsafe.Pointer(&meshlets[0])), C.uint32_t(len(meshlets)),
+		unsafe.Pointer(&indices[0]), false, (*C.float)(unsafe.Pointer(&mtx[0])),
+		(*C.float)(unsafe.Pointer(eye)))
+	if num == 0 {
+		return tib, false
+	}
+	slice := (*reflect.SliceHeader)(unsafe.Pointer(buf))
+	slice.Data = uintptr(unsafe.Pointer(tib.tib.data))
+	slice.Len = int(num)
+	slice.Cap = int(num)
+	return tib, true
+}
+
+func allocTransientBuffers(verts interface{}, idxs unsafe.Pointer, decl VertexDecl, numVerts, numIndices int, index32 bool) (tvb TransientVertexBuffer, tib TransientIndexBuffer, ok bool) {
 	val := reflect.ValueOf(verts)
 	if val.Kind() != reflect.Ptr || val.Elem().Kind() != reflect.Slice {
 		panic(errors.New("bgfx: expected pointer to slice"))
@@ -648,9 +1416,10 @@ func AllocTransientBuffers(verts interface{}, idxs *[]uint16, decl VertexDecl, n
 	ok = bool(C.bgfx_alloc_transient_buffers(
 		&tvb.tvb,
 		&decl.decl,
-		C.uint16_t(numVerts),
+		C.uint32_t(numVerts),
 		&tib.tib,
-		C.uint16_t(numIndices),
+		C.uint32_t(numIndices),
+		C.bool(index32),
 	))
 	if !ok {
 		return
@@ -659,13 +1428,23 @@ func AllocTransientBuffers(verts interface{}, idxs *[]uint16, decl VertexDecl, n
 	slice.Data = uintptr(unsafe.Pointer(tvb.tvb.data))
 	slice.Len = numVerts
 	slice.Cap = numVerts
-	slice = (*reflect.SliceHeader)(unsafe.Pointer(idxs))
+	slice = (*reflect.SliceHeader)(idxs)
 	slice.Data = uintptr(unsafe.Pointer(tib.tib.data))
 	slice.Len = numIndices
 	slice.Cap = numIndices
 	return
 }
 
+func AllocTransientBuffers(verts interface{}, idxs *[]uint16, decl VertexDecl, numVerts, numIndices int) (tvb TransientVertexBuffer, tib TransientIndexBuffer, ok bool) {
+	return allocTransientBuffers(verts, unsafe.Pointer(idxs), decl, numVerts, numIndices, false)
+}
+
+// AllocTransientBuffers32 allocates transient vertex buffer and transient
+// index buffer with 32-bit indices, which requires CapsIndex32.
+func AllocTransientBuffers32(verts interface{}, idxs *[]uint32, decl VertexDecl, numVerts, numIndices int) (tvb TransientVertexBuffer, tib TransientIndexBuffer, ok bool) {
+	return allocTransientBuffers(verts, unsafe.Pointer(idxs), decl, numVerts, numIndices, true)
+}
+
 type InstanceDataBuffer struct {
 	b    *C.bgfx_instance_data_buffer_t
 	data []byte
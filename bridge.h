@@ -9,3 +9,7 @@
 // serves as cgo's interface to bgfx_dbg_text_printf, since cgo does not
 // like varargs (wouldn't be typesafe).
 BGFX_C_API void bgfx_dbg_text_print(uint32_t x, uint32_t y, uint8_t attr, const char *text);
+
+// exposes internal image decoding to tests, which compare optimized
+// decoders against the scalar reference implementation (ref != 0).
+BGFX_C_API void bgfx_image_decode_to_bgra8(uint8_t* dst, const uint8_t* src, uint32_t width, uint32_t height, uint32_t pitch, uint8_t format, int ref);
@@ -18,6 +18,14 @@ func TestConstResetFlag(t *testing.T) {
 	}
 }
 
+func TestConstCaptureFormat(t *testing.T) {
+	for _, d := range captureFormatTable {
+		if d.a != CaptureFormat(d.b) {
+			t.Errorf("%d != %d", d.a, d.b)
+		}
+	}
+}
+
 func TestConstDebugOptions(t *testing.T) {
 	for _, d := range debugOptionsTable {
 		if d.a != DebugOptions(d.b) {
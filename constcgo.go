@@ -34,6 +34,16 @@ var resetFlagsTable = []struct {
 	{ResetCapture, C.BGFX_RESET_CAPTURE},
 }
 
+var captureFormatTable = []struct {
+	a CaptureFormat
+	b C.bgfx_capture_format_t
+}{
+	{CaptureFormatCallback, C.BGFX_CAPTURE_FORMAT_CALLBACK},
+	{CaptureFormatY4m, C.BGFX_CAPTURE_FORMAT_Y4M},
+	{CaptureFormatTga, C.BGFX_CAPTURE_FORMAT_TGA},
+	{CaptureFormatQoi, C.BGFX_CAPTURE_FORMAT_QOI},
+}
+
 var debugOptionsTable = []struct {
 	a DebugOptions
 	b C.uint32_t
@@ -68,6 +78,7 @@ var capFlagsTable = []struct {
 	{CapsCompute, C.BGFX_CAPS_COMPUTE},
 	{CapsFragmentOrdering, C.BGFX_CAPS_FRAGMENT_ORDERING},
 	{CapsSwapChain, C.BGFX_CAPS_SWAP_CHAIN},
+	{CapsIndex32, C.BGFX_CAPS_INDEX32},
 }
 
 var uniformTypeTable = []struct {
@@ -207,6 +218,7 @@ var texFlagsTable = []struct {
 	{TextureMipPoint, C.BGFX_TEXTURE_MIP_POINT},
 	{TextureMipShift, C.BGFX_TEXTURE_MIP_SHIFT},
 	{TextureMipMask, C.BGFX_TEXTURE_MIP_MASK},
+	{TextureResize, C.BGFX_TEXTURE_RESIZE},
 	{TextureRT, C.BGFX_TEXTURE_RT},
 	{TextureRTMSAAX2, C.BGFX_TEXTURE_RT_MSAA_X2},
 	{TextureRTMSAAX4, C.BGFX_TEXTURE_RT_MSAA_X4},
@@ -228,6 +240,9 @@ var texFlagsTable = []struct {
 	{TextureCompareShift, C.BGFX_TEXTURE_COMPARE_SHIFT},
 	{TextureCompareMask, C.BGFX_TEXTURE_COMPARE_MASK},
 	{TextureComputeWrite, C.BGFX_TEXTURE_COMPUTE_WRITE},
+	{TextureAsync, C.BGFX_TEXTURE_ASYNC},
+	{TextureMipsSrgb, C.BGFX_TEXTURE_MIPS_SRGB},
+	{TextureStream, C.BGFX_TEXTURE_STREAM},
 	//{TextureReservedShift, C.BGFX_TEXTURE_RESERVED_SHIFT},
 	//{TextureReservedMask, C.BGFX_TEXTURE_RESERVED_MASK},
 }
@@ -0,0 +1,486 @@
+package bgfx
+
+import (
+	"bytes"
+	"encoding/binary"
+	"math"
+	"math/rand"
+	"testing"
+)
+
+func TestImageDecodeToBgra8(t *testing.T) {
+	formats := []struct {
+		format    TextureFormat
+		blockSize int
+	}{
+		{TextureFormatBC1, 8},
+		{TextureFormatBC2, 16},
+		{TextureFormatBC3, 16},
+		{TextureFormatBC4, 8},
+		{TextureFormatBC5, 16},
+		{TextureFormatETC1, 8},
+		{TextureFormatETC2, 8},
+	}
+
+	// Sizes cover partial SIMD groups and multithreaded bands.
+	sizes := [][2]int{{4, 4}, {28, 12}, {260, 8}, {1024, 1028}}
+
+	rng := rand.New(rand.NewSource(1))
+	for _, f := range formats {
+		for _, size := range sizes {
+			width, height := size[0], size[1]
+			src := make([]byte, width/4*height/4*f.blockSize)
+			rng.Read(src)
+
+			// Equal endpoints exercise DXT1 3-color and DXT5 6-alpha modes.
+			for ii := 0; ii < len(src); ii += 8 * 7 {
+				src[ii] = src[ii+2]
+				src[ii+1] = src[ii+3]
+			}
+
+			ref := imageDecodeToBgra8(src, width, height, f.format, true)
+			opt := imageDecodeToBgra8(src, width, height, f.format, false)
+			if !bytes.Equal(ref, opt) {
+				t.Errorf("format %d, %dx%d: decoded image doesn't match reference", f.format, width, height)
+			}
+		}
+	}
+}
+
+// mipRef box filters BGRA8 level with clamped coordinates.
+func mipRef(src []byte, width, height, depth int) ([]byte, int, int, int) {
+	dw, dh, dd := max(1, width/2), max(1, height/2), max(1, depth/2)
+	dst := make([]byte, dw*dh*dd*4)
+	n := 4
+	if depth > 1 {
+		n = 8
+	}
+	for z := 0; z < dd; z++ {
+		for y := 0; y < dh; y++ {
+			for x := 0; x < dw; x++ {
+				for c := 0; c < 4; c++ {
+					sum := 0
+					for ii := 0; ii < n; ii++ {
+						sx := min(x*2+ii&1, width-1)
+						sy := min(y*2+ii>>1&1, height-1)
+						sz := min(z*2+ii>>2, depth-1)
+						sum += int(src[((sz*height+sy)*width+sx)*4+c])
+					}
+					dst[((z*dh+y)*dw+x)*4+c] = byte((sum + n/2) / n)
+				}
+			}
+		}
+	}
+	return dst, dw, dh, dd
+}
+
+func TestImageGenerateMips(t *testing.T) {
+	sizes := [][3]int{{2, 2, 1}, {37, 21, 1}, {300, 200, 1}, {1024, 512, 1}, {9, 6, 5}}
+
+	rng := rand.New(rand.NewSource(1))
+	for _, size := range sizes {
+		width, height, depth := size[0], size[1], size[2]
+		numMips := 1
+		for max(width, height, depth)>>numMips != 0 {
+			numMips++
+		}
+
+		src := make([]byte, width*height*depth*4)
+		rng.Read(src)
+
+		mips, ok := imageGenerateMips(src, width, height, depth, 1, numMips, 4, TextureFormatBGRA8, false)
+		if !ok {
+			t.Fatalf("BGRA8 mip generation failed")
+		}
+
+		level, w, h, d := src, width, height, depth
+		for lod := 0; lod < numMips; lod++ {
+			got := mips[:len(level)]
+			mips = mips[len(level):]
+			for ii := range level {
+				if diff := int(got[ii]) - int(level[ii]); diff < -1 || diff > 1 {
+					t.Fatalf("%dx%dx%d lod %d: byte %d is %d, expected %d", width, height, depth, lod, ii, got[ii], level[ii])
+				}
+			}
+			// Continue from generated level, so rounding differences don't
+			// accumulate.
+			level, w, h, d = mipRef(got, w, h, d)
+		}
+	}
+}
+
+func TestImageGenerateMipsSrgb(t *testing.T) {
+	// Black and white average to 50% linear intensity, and alpha is
+	// always filtered linearly.
+	src := []byte{0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255}
+	mips, _ := imageGenerateMips(src, 2, 2, 1, 1, 2, 4, TextureFormatBGRA8, true)
+	if expected := []byte{188, 188, 188, 128}; !bytes.Equal(mips[16:], expected) {
+		t.Errorf("sRGB mip is %v, expected %v", mips[16:], expected)
+	}
+
+	// Constant sides stay constant through whole chain.
+	const size = 64
+	src = make([]byte, 6*size*size*4)
+	for ii := range src {
+		src[ii] = byte(ii / (size * size * 4) * 40)
+	}
+	mips, _ = imageGenerateMips(src, size, size, 1, 6, 7, 4, TextureFormatBGRA8, true)
+	sideSize := len(mips) / 6
+	for ii := range mips {
+		if expected := byte(ii / sideSize * 40); mips[ii] != expected {
+			t.Fatalf("side %d byte %d is %d, expected %d", ii/sideSize, ii%sideSize, mips[ii], expected)
+		}
+	}
+}
+
+func TestImageGenerateMipsFloat(t *testing.T) {
+	src := make([]byte, 2*2*2*16)
+	for ii := 0; ii < 8; ii++ {
+		binary.LittleEndian.PutUint32(src[ii*16:], math.Float32bits(float32(ii)))
+	}
+	mips, ok := imageGenerateMips(src, 2, 2, 2, 1, 2, 16, TextureFormatRGBA32F, false)
+	if !ok {
+		t.Fatalf("RGBA32F mip generation failed")
+	}
+	if avg := math.Float32frombits(binary.LittleEndian.Uint32(mips[len(src):])); avg != 3.5 {
+		t.Errorf("RGBA32F volume mip is %f, expected 3.5", avg)
+	}
+
+	// 1.0 and 2.0 as half floats.
+	src = []byte{0x00, 0x3c, 0, 0, 0, 0, 0, 0, 0x00, 0x40, 0, 0, 0, 0, 0, 0}
+	mips, ok = imageGenerateMips(src, 2, 1, 1, 1, 2, 8, TextureFormatRGBA16F, false)
+	if !ok {
+		t.Fatalf("RGBA16F mip generation failed")
+	}
+	if avg := binary.LittleEndian.Uint16(mips[len(src):]); avg != 0x3e00 {
+		t.Errorf("RGBA16F mip is %#x, expected 0x3e00", avg)
+	}
+
+	if _, ok := imageGenerateMips(src, 4, 4, 1, 1, 2, 1, TextureFormatBC1, false); ok {
+		t.Errorf("BC1 mip generation should fail")
+	}
+}
+
+func TestImageEncodeFromBgra8(t *testing.T) {
+	formats := []struct {
+		format    TextureFormat
+		blockSize int
+		channels  []int
+		maxRmse   float64
+	}{
+		{TextureFormatBC1, 8, []int{0, 1, 2}, 5},
+		{TextureFormatBC3, 16, []int{0, 1, 2, 3}, 5},
+		{TextureFormatBC4, 8, []int{0}, 1.5},
+		{TextureFormatBC5, 16, []int{1, 2}, 1.5},
+	}
+
+	// Smooth image with noise, size not multiple of 4 exercises edge blocks.
+	const width, height = 150, 90
+	rng := rand.New(rand.NewSource(1))
+	src := make([]byte, width*height*4)
+	for y := 0; y < height; y++ {
+		for x := 0; x < width; x++ {
+			for c := 0; c < 4; c++ {
+				val := 128 + 100*math.Sin(float64(x*(c+1))/40+float64(y*(4-c))/30) + rng.Float64()*6
+				src[(y*width+x)*4+c] = byte(val)
+			}
+		}
+	}
+
+	const decWidth, decHeight = (width + 3) &^ 3, (height + 3) &^ 3
+	for _, f := range formats {
+		prevRmse := math.Inf(1)
+		for quality := 0; quality < 3; quality++ {
+			enc, ok := imageEncodeFromBgra8(src, width, height, f.format, f.blockSize, quality)
+			if !ok {
+				t.Fatalf("format %d: encoding failed", f.format)
+			}
+			dec := imageDecodeToBgra8(enc, decWidth, decHeight, f.format, true)
+
+			sum := 0.0
+			for y := 0; y < height; y++ {
+				for x := 0; x < width; x++ {
+					for _, c := range f.channels {
+						diff := float64(dec[(y*decWidth+x)*4+c]) - float64(src[(y*width+x)*4+c])
+						sum += diff * diff
+					}
+				}
+			}
+			rmse := math.Sqrt(sum / float64(width*height*len(f.channels)))
+			if rmse > f.maxRmse {
+				t.Errorf("format %d quality %d: RMSE %f exceeds %f", f.format, quality, rmse, f.maxRmse)
+			}
+			if rmse > prevRmse+0.01 {
+				t.Errorf("format %d quality %d: RMSE %f is worse than lower quality %f", f.format, quality, rmse, prevRmse)
+			}
+			prevRmse = rmse
+		}
+	}
+
+	// Solid colors representable in 565 are encoded exactly.
+	solid := make([]byte, 4*4*4)
+	for ii := 0; ii < len(solid); ii += 4 {
+		copy(solid[ii:], []byte{0x42, 0x82, 0xff, 0xff})
+	}
+	enc, _ := imageEncodeFromBgra8(solid, 4, 4, TextureFormatBC1, 8, 1)
+	if dec := imageDecodeToBgra8(enc, 4, 4, TextureFormatBC1, true); !bytes.Equal(dec, solid) {
+		t.Errorf("solid BC1 block decodes to %v, expected %v", dec[:4], solid[:4])
+	}
+
+	if _, ok := imageEncodeFromBgra8(solid, 4, 4, TextureFormatETC1, 8, 1); ok {
+		t.Errorf("ETC1 encoding should fail")
+	}
+}
+
+func BenchmarkImageEncodeBC1(b *testing.B) {
+	const size = 1024
+	src := make([]byte, size*size*4)
+	rand.New(rand.NewSource(1)).Read(src)
+
+	b.SetBytes(size * size * 4)
+	for ii := 0; ii < b.N; ii++ {
+		imageEncodeFromBgra8(src, size, size, TextureFormatBC1, 8, 1)
+	}
+}
+
+func benchmarkImageDecodeToBgra8(b *testing.B, format TextureFormat, ref bool) {
+	const size = 1024
+	src := make([]byte, size/4*size/4*8)
+	rand.New(rand.NewSource(1)).Read(src)
+
+	b.SetBytes(size * size * 4)
+	for ii := 0; ii < b.N; ii++ {
+		imageDecodeToBgra8(src, size, size, format, ref)
+	}
+}
+
+func BenchmarkImageDecodeBC1(b *testing.B) {
+	benchmarkImageDecodeToBgra8(b, TextureFormatBC1, false)
+}
+
+func BenchmarkImageDecodeBC1Ref(b *testing.B) {
+	benchmarkImageDecodeToBgra8(b, TextureFormatBC1, true)
+}
+
+func BenchmarkImageDecodeETC2(b *testing.B) {
+	benchmarkImageDecodeToBgra8(b, TextureFormatETC2, false)
+}
+
+func BenchmarkImageDecodeETC2Ref(b *testing.B) {
+	benchmarkImageDecodeToBgra8(b, TextureFormatETC2, true)
+}
+
+func TestImageConvert(t *testing.T) {
+	const width, height = 37, 5
+	rnd := rand.New(rand.NewSource(1))
+	bgra := make([]byte, width*height*4)
+	rnd.Read(bgra)
+
+	convert := func(src []byte, dstFormat, srcFormat TextureFormat, dstBpp int, premultiply bool) []byte {
+		dst, ok := imageConvert(src, width, height, dstFormat, srcFormat, dstBpp, premultiply)
+		if !ok {
+			t.Fatalf("conversion from %d to %d failed", srcFormat, dstFormat)
+		}
+		return dst
+	}
+
+	// SIMD kernels must match generic path, which is taken when going
+	// through RGBA32F.
+	rgba32f := convert(bgra, TextureFormatRGBA32F, TextureFormatBGRA8, 16, false)
+	for _, format := range []TextureFormat{TextureFormatR5G6B5, TextureFormatRGBA4, TextureFormatRGB5A1} {
+		packed := convert(bgra, format, TextureFormatBGRA8, 2, false)
+		if ref := convert(rgba32f, format, TextureFormatRGBA32F, 2, false); !bytes.Equal(packed, ref) {
+			t.Errorf("format %d: packing doesn't match reference", format)
+		}
+
+		unpacked := convert(packed, TextureFormatBGRA8, format, 4, false)
+		ref := convert(convert(packed, TextureFormatRGBA32F, format, 16, false), TextureFormatBGRA8, TextureFormatRGBA32F, 4, false)
+		if !bytes.Equal(unpacked, ref) {
+			t.Errorf("format %d: unpacking doesn't match reference", format)
+		}
+	}
+
+	premultiplied := convert(bgra, TextureFormatBGRA8, TextureFormatBGRA8, 4, true)
+	ref := convert(convert(bgra, TextureFormatRGBA32F, TextureFormatBGRA8, 16, true), TextureFormatBGRA8, TextureFormatRGBA32F, 4, false)
+	if !bytes.Equal(premultiplied, ref) {
+		t.Errorf("premultiplied alpha doesn't match reference")
+	}
+
+	r8 := bgra[:width*height]
+	expanded := convert(r8, TextureFormatBGRA8, TextureFormatR8, 4, false)
+	for ii, r := range r8 {
+		if got := expanded[ii*4 : ii*4+4]; !bytes.Equal(got, []byte{0, 0, r, 0xff}) {
+			t.Fatalf("R8 pixel %d expands to %v", ii, got)
+		}
+	}
+
+	if _, ok := imageConvert(bgra, 4, 4, TextureFormatBGRA8, TextureFormatBC1, 4, false); ok {
+		t.Errorf("BC1 conversion should fail")
+	}
+}
+
+func TestImageConvertHalf(t *testing.T) {
+	// All half values, R16F to R32F has SIMD kernel, R16F to RG32F
+	// doesn't.
+	halfs := make([]byte, 0x10000*2)
+	for ii := 0; ii < 0x10000; ii++ {
+		binary.LittleEndian.PutUint16(halfs[ii*2:], uint16(ii))
+	}
+
+	floats, _ := imageConvert(halfs, 0x100, 0x100, TextureFormatR32F, TextureFormatR16F, 4, false)
+	ref, _ := imageConvert(halfs, 0x100, 0x100, TextureFormatRG32F, TextureFormatR16F, 8, false)
+	for ii := 0; ii < 0x10000; ii++ {
+		got := math.Float32frombits(binary.LittleEndian.Uint32(floats[ii*4:]))
+		expected := math.Float32frombits(binary.LittleEndian.Uint32(ref[ii*8:]))
+		if got != expected && !(math.IsNaN(float64(got)) && math.IsNaN(float64(expected))) {
+			t.Fatalf("half %#04x converts to %g, expected %g", ii, got, expected)
+		}
+	}
+
+	const num = 0x10000
+	rnd := rand.New(rand.NewSource(1))
+	src := make([]byte, num*4)
+	for ii := 0; ii < num; ii++ {
+		// Exponents around half range, to cover denormals and overflow.
+		bits := rnd.Uint32()&0x807fffff | uint32(127-30+rnd.Intn(50))<<23
+		switch ii {
+		case 0:
+			bits = 0x7f800000
+		case 1:
+			bits = 0xff800001
+		}
+		binary.LittleEndian.PutUint32(src[ii*4:], bits)
+	}
+
+	halfs, _ = imageConvert(src, num, 1, TextureFormatR16F, TextureFormatR32F, 2, false)
+	ref, _ = imageConvert(src, num, 1, TextureFormatRG16F, TextureFormatR32F, 4, false)
+	for ii := 0; ii < num; ii++ {
+		got := binary.LittleEndian.Uint16(halfs[ii*2:])
+		expected := binary.LittleEndian.Uint16(ref[ii*4:])
+		if got != expected {
+			t.Fatalf("float %#08x converts to %#04x, expected %#04x", binary.LittleEndian.Uint32(src[ii*4:]), got, expected)
+		}
+	}
+
+	edges := []struct {
+		value uint32
+		half  uint16
+	}{
+		{0x3f800000, 0x3c00}, // 1.0
+		{0x477ff000, 0x7c00}, // 65520 rounds to infinity
+		{0xc79b1d3f, 0xfc00}, // -79418
+		{0x387ff7c7, 0x0400}, // rounds up to smallest normal
+		{0x33800000, 0x0001}, // smallest denormal
+		{0x7fc00000, 0x7e00}, // NaN
+	}
+	src = make([]byte, 8*4)
+	for ii, edge := range edges {
+		binary.LittleEndian.PutUint32(src[ii*4:], edge.value)
+	}
+	kernel, _ := imageConvert(src, 8, 1, TextureFormatR16F, TextureFormatR32F, 2, false)
+	generic, _ := imageConvert(src, 8, 1, TextureFormatRG16F, TextureFormatR32F, 4, false)
+	for ii, edge := range edges {
+		if got := binary.LittleEndian.Uint16(kernel[ii*2:]); got != edge.half {
+			t.Errorf("float %#08x converts to %#04x, expected %#04x", edge.value, got, edge.half)
+		}
+		if got := binary.LittleEndian.Uint16(generic[ii*4:]); got != edge.half {
+			t.Errorf("float %#08x converts to %#04x with scalar path, expected %#04x", edge.value, got, edge.half)
+		}
+	}
+}
+
+func BenchmarkImageConvertRgba32fToRgba16f(b *testing.B) {
+	const size = 512
+	src := make([]byte, size*size*16)
+	for ii := 0; ii < size*size*4; ii++ {
+		binary.LittleEndian.PutUint32(src[ii*4:], math.Float32bits(float32(ii)/float32(size*size)))
+	}
+
+	b.SetBytes(size * size * 16)
+	for ii := 0; ii < b.N; ii++ {
+		imageConvert(src, size, size, TextureFormatRGBA16F, TextureFormatRGBA32F, 8, false)
+	}
+}
+
+func TestImageResize(t *testing.T) {
+	const width, height = 37, 23
+	bgra := make([]byte, width*height*4)
+	rand.New(rand.NewSource(1)).Read(bgra)
+
+	filters := []int{imageFilterBox, imageFilterBilinear, imageFilterMitchell, imageFilterLanczos3}
+	for _, filter := range filters {
+		same, ok := imageResize(bgra, width, height, width, height, 4, TextureFormatBGRA8, filter, false)
+		if !ok {
+			t.Fatalf("BGRA8 resize with filter %d failed", filter)
+		}
+		if !bytes.Equal(same, bgra) {
+			t.Errorf("same size resize with filter %d doesn't copy image", filter)
+		}
+	}
+
+	// Weights are normalized, so solid image stays solid at any ratio,
+	// including near image edges.
+	solid := bytes.Repeat([]byte{10, 128, 200, 255}, width*height)
+	sizes := [][2]int{{100, 7}, {1, 1}, {5, 60}, {width*2 + 1, height*3 - 1}}
+	for _, filter := range filters {
+		for _, size := range sizes {
+			dst, _ := imageResize(solid, width, height, size[0], size[1], 4, TextureFormatBGRA8, filter, true)
+			for ii := 0; ii < len(dst); ii++ {
+				if diff := int(dst[ii]) - int(solid[ii%4]); diff < -1 || diff > 1 {
+					t.Fatalf("filter %d resizing solid image to %v changes pixel %d to %v", filter, size, ii/4, dst[ii/4*4:ii/4*4+4])
+				}
+			}
+		}
+	}
+
+	// Box filter at half size matches 2x2 box filtered mip.
+	const evenWidth, evenHeight = 36, 22
+	even := make([]byte, evenWidth*evenHeight*4)
+	for yy := 0; yy < evenHeight; yy++ {
+		copy(even[yy*evenWidth*4:(yy+1)*evenWidth*4], bgra[yy*width*4:])
+	}
+	half, _ := imageResize(even, evenWidth, evenHeight, evenWidth/2, evenHeight/2, 4, TextureFormatBGRA8, imageFilterBox, false)
+	mips, _ := imageGenerateMips(even, evenWidth, evenHeight, 1, 1, 2, 4, TextureFormatBGRA8, false)
+	for ii, mip := range mips[len(even):] {
+		if diff := int(half[ii]) - int(mip); diff < -1 || diff > 1 {
+			t.Fatalf("half size box filtered pixel %d is %v, mip is %v", ii/4, half[ii/4*4:ii/4*4+4], mips[len(even)+ii/4*4:len(even)+ii/4*4+4])
+		}
+	}
+
+	// Downscaling averages all source pixels, 0..299 averaged to 149.5.
+	ramp := make([]byte, 300*16)
+	for ii := 0; ii < 300; ii++ {
+		binary.LittleEndian.PutUint32(ramp[ii*16:], math.Float32bits(float32(ii)))
+	}
+	for _, filter := range []int{imageFilterBox, imageFilterBilinear} {
+		dst, _ := imageResize(ramp, 300, 1, 1, 1, 16, TextureFormatRGBA32F, filter, false)
+		if avg := math.Float32frombits(binary.LittleEndian.Uint32(dst)); math.Abs(float64(avg)-149.5) > 0.01 {
+			t.Errorf("filter %d downscales ramp to %f, expected 149.5", filter, avg)
+		}
+	}
+
+	// 1.0 as half float upscaled stays 1.0.
+	one := []byte{0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c}
+	dst, ok := imageResize(bytes.Repeat(one, 4), 2, 2, 5, 3, 8, TextureFormatRGBA16F, imageFilterLanczos3, false)
+	if !ok {
+		t.Fatalf("RGBA16F resize failed")
+	}
+	if !bytes.Equal(dst, bytes.Repeat(one, 15)) {
+		t.Errorf("RGBA16F resize of solid image is %v", dst)
+	}
+
+	if _, ok := imageResize(bgra, 4, 4, 2, 2, 4, TextureFormatBC1, imageFilterBox, false); ok {
+		t.Errorf("BC1 resize should fail")
+	}
+}
+
+func BenchmarkImageResizeLanczos3(b *testing.B) {
+	const width, height = 1920, 1080
+	src := make([]byte, width*height*4)
+	rand.New(rand.NewSource(1)).Read(src)
+
+	b.SetBytes(width * height * 4)
+	for ii := 0; ii < b.N; ii++ {
+		imageResize(src, width, height, 1280, 720, 4, TextureFormatBGRA8, imageFilterLanczos3, false)
+	}
+}
@@ -0,0 +1,81 @@
+package bgfx
+
+// Test files do not allow cgo, so we wrap internal image functions used
+// by tests here.
+
+// #include "bgfx.c99.h"
+// #include "bridge.h"
+import "C"
+import "unsafe"
+
+// imageDecodeToBgra8 decodes block compressed src to width*height BGRA8
+// pixels, using scalar reference decoders when ref is set.
+func imageDecodeToBgra8(src []byte, width, height int, format TextureFormat, ref bool) []byte {
+	dst := make([]byte, width*height*4)
+	r := C.int(0)
+	if ref {
+		r = 1
+	}
+	C.bgfx_image_decode_to_bgra8((*C.uint8_t)(unsafe.Pointer(&dst[0])),
+		(*C.uint8_t)(unsafe.Pointer(&src[0])),
+		C.uint32_t(width), C.uint32_t(height), C.uint32_t(width*4),
+		C.uint8_t(format), r)
+	return dst
+}
+
+// imageGenerateMips generates numMips mips for each side of src, which
+// holds top level of each side with bpp bytes per pixel.
+func imageGenerateMips(src []byte, width, height, depth, sides, numMips, bpp int, format TextureFormat, srgb bool) ([]byte, bool) {
+	size := 0
+	for w, h, d, lod := width, height, depth, 0; lod < numMips; lod++ {
+		size += w * h * d * bpp
+		w, h, d = max(1, w/2), max(1, h/2), max(1, d/2)
+	}
+	dst := make([]byte, size*sides)
+	ok := C.bgfx_image_generate_mips(C.uint16_t(width), C.uint16_t(height),
+		C.uint16_t(depth), C.uint8_t(sides), C.uint8_t(numMips),
+		C.bgfx_texture_format_t(format), C.bool(srgb),
+		unsafe.Pointer(&src[0]), unsafe.Pointer(&dst[0]))
+	return dst, bool(ok)
+}
+
+// imageEncodeFromBgra8 encodes width*height BGRA8 pixels to block
+// compressed format with blockSize bytes per block.
+func imageEncodeFromBgra8(src []byte, width, height int, format TextureFormat, blockSize, quality int) ([]byte, bool) {
+	dst := make([]byte, (width+3)/4*((height+3)/4)*blockSize)
+	ok := C.bgfx_image_encode_from_bgra8(unsafe.Pointer(&dst[0]),
+		unsafe.Pointer(&src[0]), C.uint32_t(width), C.uint32_t(height),
+		C.uint32_t(width*4), C.bgfx_texture_format_t(format),
+		C.bgfx_image_quality_t(quality))
+	return dst, bool(ok)
+}
+
+// imageConvert converts width*height pixels of src to dstFormat with
+// dstBpp bytes per pixel.
+func imageConvert(src []byte, width, height int, dstFormat, srcFormat TextureFormat, dstBpp int, premultiply bool) ([]byte, bool) {
+	dst := make([]byte, width*height*dstBpp)
+	ok := C.bgfx_image_convert(unsafe.Pointer(&dst[0]),
+		C.bgfx_texture_format_t(dstFormat), unsafe.Pointer(&src[0]),
+		C.bgfx_texture_format_t(srcFormat), C.uint32_t(width),
+		C.uint32_t(height), C.uint32_t(0xffffffff), C.bool(premultiply))
+	return dst, bool(ok)
+}
+
+// Image resize filters, see ImageFilter in bgfx.h.
+const (
+	imageFilterBox = iota
+	imageFilterBilinear
+	imageFilterMitchell
+	imageFilterLanczos3
+)
+
+// imageResize resizes width*height pixels of src with bpp bytes per pixel
+// to dstWidth*dstHeight pixels.
+func imageResize(src []byte, width, height, dstWidth, dstHeight, bpp int, format TextureFormat, filter int, srgb bool) ([]byte, bool) {
+	dst := make([]byte, dstWidth*dstHeight*bpp)
+	ok := C.bgfx_image_resize(unsafe.Pointer(&dst[0]), C.uint32_t(dstWidth),
+		C.uint32_t(dstHeight), unsafe.Pointer(&src[0]), C.uint32_t(width),
+		C.uint32_t(height), C.bgfx_texture_format_t(format),
+		C.uint32_t(width*bpp), C.bgfx_image_filter_t(filter), C.bool(srgb))
+	return dst, bool(ok)
+}
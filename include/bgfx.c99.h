@@ -129,6 +129,38 @@ typedef enum bgfx_texture_format
 
 } bgfx_texture_format_t;
 
+typedef enum bgfx_image_quality
+{
+    BGFX_IMAGE_QUALITY_FASTEST,
+    BGFX_IMAGE_QUALITY_DEFAULT,
+    BGFX_IMAGE_QUALITY_HIGHEST,
+
+    BGFX_IMAGE_QUALITY_COUNT
+
+} bgfx_image_quality_t;
+
+typedef enum bgfx_image_filter
+{
+    BGFX_IMAGE_FILTER_BOX,
+    BGFX_IMAGE_FILTER_BILINEAR,
+    BGFX_IMAGE_FILTER_MITCHELL,
+    BGFX_IMAGE_FILTER_LANCZOS3,
+
+    BGFX_IMAGE_FILTER_COUNT
+
+} bgfx_image_filter_t;
+
+typedef enum bgfx_capture_format
+{
+    BGFX_CAPTURE_FORMAT_CALLBACK,
+    BGFX_CAPTURE_FORMAT_Y4M,
+    BGFX_CAPTURE_FORMAT_TGA,
+    BGFX_CAPTURE_FORMAT_QOI,
+
+    BGFX_CAPTURE_FORMAT_COUNT
+
+} bgfx_capture_format_t;
+
 typedef enum bgfx_uniform_type
 {
     BGFX_UNIFORM_TYPE_UNIFORM1I,
@@ -172,6 +204,60 @@ typedef struct bgfx_memory
 
 } bgfx_memory_t;
 
+typedef struct bgfx_mesh_lod
+{
+    uint32_t startIndex;
+    uint32_t numIndices;
+    float    error;
+
+} bgfx_mesh_lod_t;
+
+typedef struct bgfx_meshlet
+{
+    uint32_t startIndex;
+    uint32_t numIndices;
+    float    center[3];
+    float    radius;
+    float    coneAxis[3];
+    float    coneCutoff;
+
+} bgfx_meshlet_t;
+
+typedef struct bgfx_mesh_group
+{
+    uint32_t startIndex;
+    uint32_t numIndices;
+    float    center[3];
+    float    radius;
+    float    min[3];
+    float    max[3];
+
+} bgfx_mesh_group_t;
+
+typedef struct bgfx_vertex_quantization
+{
+    float scale[3];
+    float bias[3];
+
+} bgfx_vertex_quantization_t;
+
+typedef struct bgfx_vertex_bounds
+{
+    float min[3];
+    float max[3];
+    float center[3];
+    float radius;
+
+} bgfx_vertex_bounds_t;
+
+typedef struct bgfx_mesh_optimize_stats
+{
+    float    acmrBefore;
+    float    acmrAfter;
+    uint32_t numVertices;
+
+} bgfx_mesh_optimize_stats_t;
+
 /**
  */
 typedef struct bgfx_transform
@@ -193,6 +279,38 @@ typedef struct bgfx_vertex_decl
 
 } bgfx_vertex_decl_t;
 
+/**
+ * Mesh container contents.
+ */
+typedef struct bgfx_mesh_data
+{
+    bgfx_vertex_decl_t decl;
+    const void* vertices;
+    uint32_t numVertices;
+    const void* indices;
+    uint32_t numIndices;
+    bool index32;
+    const bgfx_mesh_group_t* groups;
+    uint32_t numGroups;
+    const bgfx_mesh_lod_t* lods;
+    uint32_t numLods;
+    const bgfx_meshlet_t* meshlets;
+    uint32_t numMeshlets;
+
+} bgfx_mesh_data_t;
+
+/**
+ * Mesh loaded from file.
+ */
+typedef struct bgfx_mesh
+{
+    bgfx_mesh_data_t data;
+    bgfx_vertex_buffer_handle_t vbh;
+    bgfx_index_buffer_handle_t ibh;
+    void* mapping;
+
+} bgfx_mesh_t;
+
 /**
  */
 typedef struct bgfx_transient_index_buffer
@@ -201,6 +319,7 @@ typedef struct bgfx_transient_index_buffer
     uint32_t size;
     bgfx_index_buffer_handle_t handle;
     uint32_t startIndex;
+    bool index32;
 
 } bgfx_transient_index_buffer_t;
 
@@ -244,6 +363,11 @@ typedef struct bgfx_texture_info
 
 } bgfx_texture_info_t;
 
+/**
+ *  Texture atlas, see bgfx_create_atlas.
+ */
+typedef struct bgfx_atlas bgfx_atlas_t;
+
 /**
  *  Renderer capabilities.
  */
@@ -458,6 +582,34 @@ BGFX_C_API void bgfx_vertex_pack(const float _input[4], bool _inputNormalized, b
  */
 BGFX_C_API void bgfx_vertex_unpack(float _output[4], bgfx_attrib_t _attr, const bgfx_vertex_decl_t* _decl, const void* _data, uint32_t _index);
 
+/**
+ *  Pack array of vectors into vertex stream format.
+ *
+ *  @param _input Input array, _inputNum floats per vertex.
+ *  @param _inputNum Number of floats per vertex in input array.
+ *  @param _inputNormalized Input is normalized, same as in bgfx_vertex_pack.
+ *  @param _attr Attribute to pack.
+ *  @param _decl Vertex stream declaration.
+ *  @param _data Destination vertex stream.
+ *  @param _num Number of vertices to pack.
+ *  @param _index Index of first destination vertex.
+ */
+BGFX_C_API void bgfx_vertex_pack_array(const float* _input, uint8_t _inputNum, bool _inputNormalized, bgfx_attrib_t _attr, const bgfx_vertex_decl_t* _decl, void* _data, uint32_t _num, uint32_t _index);
+
+/**
+ *  Unpack array of vectors from vertex stream format.
+ *
+ *  @param _output Output array, _outputNum floats per vertex. Components
+ *    missing in vertex stream are set to zero.
+ *  @param _outputNum Number of floats per vertex in output array.
+ *  @param _attr Attribute to unpack.
+ *  @param _decl Vertex stream declaration.
+ *  @param _data Source vertex stream.
+ *  @param _num Number of vertices to unpack.
+ *  @param _index Index of first source vertex.
+ */
+BGFX_C_API void bgfx_vertex_unpack_array(float* _output, uint8_t _outputNum, bgfx_attrib_t _attr, const bgfx_vertex_decl_t* _decl, const void* _data, uint32_t _num, uint32_t _index);
+
 /**
  *  Converts vertex stream data from one vertex stream format to another.
  *
@@ -469,6 +621,54 @@ BGFX_C_API void bgfx_vertex_unpack(float _output[4], bgfx_attrib_t _attr, const
  */
 BGFX_C_API void bgfx_vertex_convert(const bgfx_vertex_decl_t* _destDecl, void* _destData, const bgfx_vertex_decl_t* _srcDecl, const void* _srcData, uint32_t _num);
 
+/**
+ *  Calculate bounding box and bounding sphere of position stream.
+ *  Position can be of any attribute type.
+ *
+ *  @param _decl Vertex stream declaration.
+ *  @param _vertices Vertex stream.
+ *  @param _numVertices Number of vertices.
+ *  @returns Bounds, all zero when there are no positions.
+ */
+BGFX_C_API bgfx_vertex_bounds_t bgfx_calc_vertex_bounds(const bgfx_vertex_decl_t* _decl, const void* _vertices, uint32_t _numVertices);
+
+/**
+ *  Calculate tangent frames of triangle list from position, normal and
+ *  texture coordinate 0, and write them to tangent and bitangent. Vertex
+ *  stream is unchanged if declaration doesn't have all of position,
+ *  normal, texture coordinate 0 and tangent.
+ *
+ *  @param _vertices Vertex stream.
+ *  @param _numVertices Number of vertices.
+ *  @param _decl Vertex stream declaration.
+ *  @param _indices Triangle list indices.
+ *  @param _numIndices Number of indices.
+ *  @param _index32 Indices are 32-bit, otherwise 16-bit.
+ */
+BGFX_C_API void bgfx_calc_tangents(void* _vertices, uint32_t _numVertices, const bgfx_vertex_decl_t* _decl, const void* _indices, uint32_t _numIndices, bool _index32);
+
+/**
+ *  Create compact vertex declaration for bgfx_quantize_vertices. Only
+ *  float attributes are quantized, other attributes are copied.
+ *
+ *  @param _destDecl Quantized vertex stream declaration.
+ *  @param _srcDecl Source vertex stream declaration.
+ */
+BGFX_C_API void bgfx_quantize_vertex_decl(bgfx_vertex_decl_t* _destDecl, const bgfx_vertex_decl_t* _srcDecl);
+
+/**
+ *  Quantize vertex stream.
+ *
+ *  @param _destDecl Quantized vertex stream declaration, created with
+ *    bgfx_quantize_vertex_decl from _srcDecl.
+ *  @param _destData Quantized vertex stream.
+ *  @param _srcDecl Source vertex stream declaration.
+ *  @param _srcData Source vertex stream.
+ *  @param _num Number of vertices.
+ *  @returns Position dequantization.
+ */
+BGFX_C_API bgfx_vertex_quantization_t bgfx_quantize_vertices(const bgfx_vertex_decl_t* _destDecl, void* _destData, const bgfx_vertex_decl_t* _srcDecl, const void* _srcData, uint32_t _num);
+
 /**
  *  Weld vertices.
  *
@@ -482,6 +682,239 @@ BGFX_C_API void bgfx_vertex_convert(const bgfx_vertex_decl_t* _destDecl, void* _
  */
 BGFX_C_API uint16_t bgfx_weld_vertices(uint16_t* _output, const bgfx_vertex_decl_t* _decl, const void* _data, uint16_t _num, float _epsilon);
 
+/**
+ *  Weld vertices of large vertex stream.
+ *
+ *  @param _output Welded vertices remapping table, index of each vertex
+ *    in compacted vertex stream. The size of buffer must be the same as
+ *    number of vertices.
+ *  @param _dstData Compacted vertex stream with unique vertices, in order
+ *    of first occurrence. Can be NULL when only remapping table is needed.
+ *  @param _decl Vertex stream declaration.
+ *  @param _data Vertex stream.
+ *  @param _num Number of vertices in vertex stream.
+ *  @param _epsilon Error tolerance for vertex position comparison, and
+ *    for each component of additional attributes.
+ *  @param _attribs Additional attributes that must match for vertices to
+ *    be welded.
+ *  @param _numAttribs Number of additional attributes.
+ *  @returns Number of unique vertices after vertex welding.
+ */
+BGFX_C_API uint32_t bgfx_weld_vertices32(uint32_t* _output, void* _dstData, const bgfx_vertex_decl_t* _decl, const void* _data, uint32_t _num, float _epsilon, const bgfx_attrib_t* _attribs, uint8_t _numAttribs);
+
+/**
+ *  Returns average cache miss ratio (ACMR), number of vertex shader
+ *  invocations per triangle, of triangle list for FIFO post-transform
+ *  vertex cache.
+ *
+ *  @param _indices Triangle list indices.
+ *  @param _numIndices Number of indices.
+ *  @param _index32 Indices are 32-bit, otherwise 16-bit.
+ *  @param _cacheSize Number of vertex cache entries, up to 64.
+ */
+BGFX_C_API float bgfx_vertex_cache_miss_ratio(const void* _indices, uint32_t _numIndices, bool _index32, uint32_t _cacheSize);
+
+/**
+ *  Reorder triangles for post-transform vertex cache locality.
+ *
+ *  @param _dst Reordered indices, can be the same as _indices.
+ *  @param _indices Triangle list indices.
+ *  @param _numIndices Number of indices.
+ *  @param _index32 Indices are 32-bit, otherwise 16-bit.
+ *  @param _numVertices Number of vertices referenced by indices.
+ */
+BGFX_C_API void bgfx_optimize_vertex_cache(void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, uint32_t _numVertices);
+
+/**
+ *  Reorder clusters of vertex cache optimized triangles to reduce
+ *  overdraw.
+ *
+ *  @param _dst Reordered indices, can be the same as _indices.
+ *  @param _indices Triangle list indices, already optimized with
+ *    bgfx_optimize_vertex_cache.
+ *  @param _numIndices Number of indices.
+ *  @param _index32 Indices are 32-bit, otherwise 16-bit.
+ *  @param _decl Vertex stream declaration.
+ *  @param _vertices Vertex stream.
+ *  @param _threshold Allowed ACMR increase (f.e. 1.05 allows 5% increase).
+ */
+BGFX_C_API void bgfx_optimize_overdraw(void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, const bgfx_vertex_decl_t* _decl, const void* _vertices, float _threshold);
+
+/**
+ *  Reorder vertices in order of first use by indices, and remap indices
+ *  in place.
+ *
+ *  @param _dstVertices Reordered vertex stream, must not overlap with
+ *    _vertices.
+ *  @param _indices Triangle list indices, remapped in place.
+ *  @param _numIndices Number of indices.
+ *  @param _index32 Indices are 32-bit, otherwise 16-bit.
+ *  @param _decl Vertex stream declaration.
+ *  @param _vertices Vertex stream.
+ *  @param _numVertices Number of vertices in vertex stream.
+ *  @returns Number of vertices written to _dstVertices.
+ */
+BGFX_C_API uint32_t bgfx_optimize_vertex_fetch(void* _dstVertices, void* _indices, uint32_t _numIndices, bool _index32, const bgfx_vertex_decl_t* _decl, const void* _vertices, uint32_t _numVertices);
+
+/**
+ *  Optimize mesh for vertex cache, overdraw and vertex fetch.
+ *
+ *  @param _dstVertices Reordered vertex stream, must not overlap with
+ *    _vertices.
+ *  @param _indices Triangle list indices, reordered and remapped in place.
+ *  @param _numIndices Number of indices.
+ *  @param _index32 Indices are 32-bit, otherwise 16-bit.
+ *  @param _decl Vertex stream declaration.
+ *  @param _vertices Vertex stream.
+ *  @param _numVertices Number of vertices in vertex stream.
+ *  @param _overdrawThreshold See: bgfx_optimize_overdraw.
+ *  @returns ACMR before and after optimization.
+ */
+BGFX_C_API bgfx_mesh_optimize_stats_t bgfx_optimize_mesh(void* _dstVertices, void* _indices, uint32_t _numIndices, bool _index32, const bgfx_vertex_decl_t* _decl, const void* _vertices, uint32_t _numVertices, float _overdrawThreshold);
+
+/**
+ *  Simplify triangle list with quadric error metric edge collapses.
+ *
+ *  @param _dst Simplified indices, can be the same as _indices.
+ *  @param _indices Triangle list indices.
+ *  @param _numIndices Number of indices.
+ *  @param _index32 Indices are 32-bit, otherwise 16-bit.
+ *  @param _decl Vertex stream declaration.
+ *  @param _vertices Vertex stream.
+ *  @param _numVertices Number of vertices in vertex stream.
+ *  @param _targetIndices Target number of indices.
+ *  @param _maxError Maximum error, relative to largest extent of mesh
+ *    bounds.
+ *  @param _attribs Attributes whose squared difference is added to
+ *    collapse error.
+ *  @param _numAttribs Number of attributes in _attribs.
+ *  @param _error Resulting error, can be NULL.
+ *  @returns Number of indices written to _dst.
+ */
+BGFX_C_API uint32_t bgfx_simplify_mesh(void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, const bgfx_vertex_decl_t* _decl, const void* _vertices, uint32_t _numVertices, uint32_t _targetIndices, float _maxError, const bgfx_attrib_t* _attribs, uint8_t _numAttribs, float* _error);
+
+/**
+ *  Generate mesh LOD chain. LOD 0 is original mesh.
+ *
+ *  @param _lods LODs, sorted from most detailed.
+ *  @param _maxLods Maximum number of LODs.
+ *  @param _dst Indices of all LODs, can be the same as _indices.
+ *  @param _maxIndices Maximum number of indices in _dst.
+ *  @param _indices Triangle list indices.
+ *  @param _numIndices Number of indices.
+ *  @param _index32 Indices are 32-bit, otherwise 16-bit.
+ *  @param _decl Vertex stream declaration.
+ *  @param _vertices Vertex stream.
+ *  @param _numVertices Number of vertices in vertex stream.
+ *  @param _ratio Ratio of triangles of each LOD to previous LOD.
+ *  @param _attribs See: bgfx_simplify_mesh.
+ *  @param _numAttribs Number of attributes in _attribs.
+ *  @returns Number of LODs written to _lods.
+ */
+BGFX_C_API uint8_t bgfx_generate_mesh_lods(bgfx_mesh_lod_t* _lods, uint8_t _maxLods, void* _dst, uint32_t _maxIndices, const void* _indices, uint32_t _numIndices, bool _index32, const bgfx_vertex_decl_t* _decl, const void* _vertices, uint32_t _numVertices, float _ratio, const bgfx_attrib_t* _attribs, uint8_t _numAttribs);
+
+/**
+ *  Select least detailed LOD whose error is within _pixelError on screen.
+ *
+ *  @param _lods LODs, sorted from most detailed.
+ *  @param _numLods Number of LODs.
+ *  @param _screenSize Largest extent of mesh bounds projected on screen
+ *    in pixels.
+ *  @param _pixelError Maximum error in pixels.
+ *  @returns LOD index.
+ */
+BGFX_C_API uint8_t bgfx_select_mesh_lod(const bgfx_mesh_lod_t* _lods, uint8_t _numLods, float _screenSize, float _pixelError);
+
+/**
+ *  Partition triangle list into meshlets. Triangles are reordered so that
+ *  each meshlet is consecutive range of indices.
+ *
+ *  @param _meshlets Meshlets, up to number of triangles. Can be NULL to
+ *    only count meshlets.
+ *  @param _dst Reordered indices, can be the same as _indices.
+ *  @param _indices Triangle list indices.
+ *  @param _numIndices Number of indices.
+ *  @param _index32 Indices are 32-bit, otherwise 16-bit.
+ *  @param _decl Vertex stream declaration.
+ *  @param _vertices Vertex stream.
+ *  @param _numVertices Number of vertices in vertex stream.
+ *  @param _maxVertices Maximum number of unique vertices per meshlet.
+ *  @param _maxTriangles Maximum number of triangles per meshlet.
+ *  @returns Number of meshlets.
+ */
+BGFX_C_API uint32_t bgfx_build_meshlets(bgfx_meshlet_t* _meshlets, void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, const bgfx_vertex_decl_t* _decl, const void* _vertices, uint32_t _numVertices, uint32_t _maxVertices, uint32_t _maxTriangles);
+
+/**
+ *  Write indices of meshlets inside view frustum and not facing away from
+ *  eye.
+ *
+ *  @param _dst Indices of visible meshlets, can be NULL to only count
+ *    indices.
+ *  @param _meshlets Meshlets.
+ *  @param _numMeshlets Number of meshlets.
+ *  @param _indices Triangle list indices meshlets were built from.
+ *  @param _index32 Indices are 32-bit, otherwise 16-bit.
+ *  @param _mtx Model view projection matrix.
+ *  @param _eye Eye position in model space, or NULL to skip backface
+ *    culling.
+ *  @returns Number of indices of visible meshlets.
+ */
+BGFX_C_API uint32_t bgfx_cull_meshlets(void* _dst, const bgfx_meshlet_t* _meshlets, uint32_t _numMeshlets, const void* _indices, bool _index32, const float* _mtx, const float* _eye);
+
+/**
+ *  Allocate transient index buffer with indices of visible meshlets.
+ *
+ *  @param _tib Transient index buffer with visible indices, not allocated
+ *    when no meshlet is visible or transient index buffer is full.
+ *  @param _meshlets Meshlets.
+ *  @param _numMeshlets Number of meshlets.
+ *  @param _indices Triangle list indices meshlets were built from.
+ *  @param _index32 Indices are 32-bit, otherwise 16-bit.
+ *  @param _mtx Model view projection matrix.
+ *  @param _eye Eye position in model space, or NULL to skip backface
+ *    culling.
+ *  @returns Number of indices allocated in _tib.
+ */
+BGFX_C_API uint32_t bgfx_alloc_transient_meshlets(bgfx_transient_index_buffer_t* _tib, const bgfx_meshlet_t* _meshlets, uint32_t _numMeshlets, const void* _indices, bool _index32, const float* _mtx, const float* _eye);
+
+/**
+ *  Write mesh container.
+ *
+ *  @param _data Destination memory, or NULL to get size of container.
+ *  @param _size Size of destination memory.
+ *  @param _mesh Mesh contents. Only index ranges of groups are used,
+ *    bounds are computed from vertices. Mesh without groups is written
+ *    with single group of all indices.
+ *  @returns Size of container, or 0 if _size is too small.
+ */
+BGFX_C_API uint32_t bgfx_write_mesh(void* _data, uint32_t _size, const bgfx_mesh_data_t* _mesh);
+
+/**
+ *  Parse mesh container, nothing is copied.
+ *
+ *  @param _mesh Mesh contents, pointing into _data.
+ *  @param _data Mesh container.
+ *  @param _size Size of mesh container.
+ *  @returns True if container is valid.
+ */
+BGFX_C_API bool bgfx_parse_mesh(bgfx_mesh_data_t* _mesh, const void* _data, uint32_t _size);
+
+/**
+ *  Load mesh container file. File is memory mapped, and buffers are
+ *  created from references into mapping.
+ *
+ *  @param _mesh Loaded mesh. Contents stay valid until bgfx_destroy_mesh
+ *    is called.
+ *  @param _filePath Path to mesh file.
+ *  @returns True if mesh is loaded.
+ */
+BGFX_C_API bool bgfx_load_mesh(bgfx_mesh_t* _mesh, const char* _filePath);
+
+/**
+ *  Destroy mesh buffers and release file mapping.
+ */
+BGFX_C_API void bgfx_destroy_mesh(bgfx_mesh_t* _mesh);
+
 /**
  *  Swizzle RGBA8 image to BGRA8.
  *
@@ -506,6 +939,80 @@ BGFX_C_API void bgfx_image_swizzle_bgra8(uint32_t _width, uint32_t _height, uint
  */
 BGFX_C_API void bgfx_image_rgba8_downsample_2x2(uint32_t _width, uint32_t _height, uint32_t _pitch, const void* _src, void* _dst);
 
+/**
+ *  Generate mip chain with 2x2 (2x2x2 for 3D textures) box filter.
+ *
+ *  @param _width Width of top level (pixels).
+ *  @param _height Height of top level (pixels).
+ *  @param _depth Depth of top level, 0 or 1 for 2D and cube textures.
+ *  @param _numSides Number of sides, 6 for cube textures, otherwise 1.
+ *  @param _numMips Number of mips in generated chain.
+ *  @param _format Texture format. Supported formats are BGRA8,
+ *    RGBA16F and RGBA32F.
+ *  @param _srgb Filter BGRA8 color channels in linear space.
+ *  @param _src Top level of each side.
+ *  @param _dst Destination for all mips of each side, laid out the same
+ *    way as texture memory passed to bgfx_create_texture_*. Top level is
+ *    copied from _src. When _numSides is 1, _dst might be pointer to the
+ *    same memory as _src.
+ *  @returns False if format is not supported.
+ */
+BGFX_C_API bool bgfx_image_generate_mips(uint16_t _width, uint16_t _height, uint16_t _depth, uint8_t _numSides, uint8_t _numMips, bgfx_texture_format_t _format, bool _srgb, const void* _src, void* _dst);
+
+/**
+ *  Resize image to arbitrary size with separable filter.
+ *
+ *  @param _dst Destination image, _dstWidth*_dstHeight pixels. Must not
+ *    overlap _src.
+ *  @param _dstWidth Width of destination image (pixels).
+ *  @param _dstHeight Height of destination image (pixels).
+ *  @param _src Source image.
+ *  @param _srcWidth Width of source image (pixels).
+ *  @param _srcHeight Height of source image (pixels).
+ *  @param _format Format of both images. Supported formats are BGRA8,
+ *    RGBA16F and RGBA32F.
+ *  @param _srcPitch Pitch of source image (bytes). When _srcPitch is set
+ *    to UINT32_MAX, it will be calculated based on _srcWidth.
+ *  @param _filter Resampling filter.
+ *  @param _srgb Filter BGRA8 color channels in linear space.
+ *  @returns False if format is not supported.
+ */
+BGFX_C_API bool bgfx_image_resize(void* _dst, uint32_t _dstWidth, uint32_t _dstHeight, const void* _src, uint32_t _srcWidth, uint32_t _srcHeight, bgfx_texture_format_t _format, uint32_t _srcPitch, bgfx_image_filter_t _filter, bool _srgb);
+
+/**
+ *  Encode BGRA8 image to block compressed format.
+ *
+ *  @param _dst Destination image, must hold ((_width+3)/4)*((_height+3)/4)
+ *    blocks. Edge blocks of images not multiple of 4 replicate last row
+ *    and column.
+ *  @param _src Source image.
+ *  @param _width Width of input image (pixels).
+ *  @param _height Height of input image (pixels).
+ *  @param _pitch Pitch of input image (bytes).
+ *  @param _format Destination format, BC1, BC3, BC4 or BC5. Channels
+ *    are read from the same bytes bgfx decodes them to.
+ *  @param _quality Encoding quality vs speed.
+ *  @returns False if format is not supported.
+ */
+BGFX_C_API bool bgfx_image_encode_from_bgra8(void* _dst, const void* _src, uint32_t _width, uint32_t _height, uint32_t _pitch, bgfx_texture_format_t _format, bgfx_image_quality_t _quality);
+
+/**
+ *  Convert image between uncompressed texture formats.
+ *
+ *  @param _dst Destination image, _width*_height pixels of _dstFormat.
+ *    Must not overlap _src.
+ *  @param _dstFormat Destination format.
+ *  @param _src Source image.
+ *  @param _srcFormat Source format.
+ *  @param _width Width of image (pixels).
+ *  @param _height Height of image (pixels).
+ *  @param _srcPitch Pitch of source image (bytes). When _srcPitch is set
+ *    to UINT32_MAX, it will be calculated based on _width.
+ *  @param _premultiply Multiply color channels with alpha.
+ *  @returns False if conversion is not supported.
+ */
+BGFX_C_API bool bgfx_image_convert(void* _dst, bgfx_texture_format_t _dstFormat, const void* _src, bgfx_texture_format_t _srcFormat, uint32_t _width, uint32_t _height, uint32_t _srcPitch, bool _premultiply);
+
 /**
  *  Returns supported backend API renderers.
  */
@@ -541,6 +1048,24 @@ BGFX_C_API void bgfx_shutdown();
  */
 BGFX_C_API void bgfx_reset(uint32_t _width, uint32_t _height, uint32_t _flags);
 
+/**
+ *  Set destination of frames captured with BGFX_RESET_CAPTURE. It's used by
+ *  next capture started after call to bgfx_frame.
+ *
+ *  @param _format BGFX_CAPTURE_FORMAT_CALLBACK passes frames to capture
+ *    callbacks, on capture thread instead of render thread. Other formats
+ *    are written to _filePath.
+ *  @param _filePath File path. Frame number and extension are appended
+ *    for formats with file per frame.
+ */
+BGFX_C_API void bgfx_set_capture(bgfx_capture_format_t _format, const char* _filePath);
+
+/**
+ *  Returns number of frames dropped by current or last capture, as of last
+ *  call to bgfx_frame.
+ */
+BGFX_C_API uint32_t bgfx_get_capture_num_dropped();
+
 /**
  *  Advance to next frame. When using multithreaded renderer, this call
  *  just swaps internal buffers, kicks render thread, and returns. In
@@ -585,6 +1110,18 @@ BGFX_C_API const bgfx_memory_t* bgfx_copy(const void* _data, uint32_t _size);
  */
 BGFX_C_API const bgfx_memory_t* bgfx_make_ref(const void* _data, uint32_t _size);
 
+/**
+ *  Called when memory made with bgfx_make_ref_release is released. It might
+ *  be called from any thread.
+ */
+typedef void (*bgfx_release_fn_t)(void* _ptr, void* _userData);
+
+/**
+ *  Make reference to data to pass to bgfx. Data must be available until
+ *  _releaseFn is called.
+ */
+BGFX_C_API const bgfx_memory_t* bgfx_make_ref_release(const void* _data, uint32_t _size, bgfx_release_fn_t _releaseFn, void* _userData);
+
 /**
  *  Set debug flags.
  *
@@ -616,10 +1153,12 @@ BGFX_C_API void bgfx_dbg_text_printf(uint16_t _x, uint16_t _y, uint8_t _attr, co
 /**
  *  Create static index buffer.
  *
- *  NOTE:
- *    Only 16-bit index buffer is supported.
+ *  @param _mem Index buffer data.
+ *  @param _flags Buffer creation flags.
+ *    BGFX_BUFFER_NONE - 16-bit indices.
+ *    BGFX_BUFFER_INDEX32 - 32-bit indices, requires BGFX_CAPS_INDEX32.
  */
-BGFX_C_API bgfx_index_buffer_handle_t bgfx_create_index_buffer(const bgfx_memory_t* _mem);
+BGFX_C_API bgfx_index_buffer_handle_t bgfx_create_index_buffer(const bgfx_memory_t* _mem, uint16_t _flags);
 
 /**
  *  Destroy static index buffer.
@@ -646,21 +1185,17 @@ BGFX_C_API void bgfx_destroy_vertex_buffer(bgfx_vertex_buffer_handle_t _handle);
  *  Create empty dynamic index buffer.
  *
  *  @param _num Number of indices.
- *
- *  NOTE:
- *    Only 16-bit index buffer is supported.
+ *  @param _flags Buffer creation flags, see bgfx_create_index_buffer.
  */
-BGFX_C_API bgfx_dynamic_index_buffer_handle_t bgfx_create_dynamic_index_buffer(uint32_t _num);
+BGFX_C_API bgfx_dynamic_index_buffer_handle_t bgfx_create_dynamic_index_buffer(uint32_t _num, uint16_t _flags);
 
 /**
  *  Create dynamic index buffer and initialized it.
  *
  *  @param _mem Index buffer data.
- *
- *  NOTE:
- *    Only 16-bit index buffer is supported.
+ *  @param _flags Buffer creation flags, see bgfx_create_index_buffer.
  */
-BGFX_C_API bgfx_dynamic_index_buffer_handle_t bgfx_create_dynamic_index_buffer_mem(const bgfx_memory_t* _mem);
+BGFX_C_API bgfx_dynamic_index_buffer_handle_t bgfx_create_dynamic_index_buffer_mem(const bgfx_memory_t* _mem, uint16_t _flags);
 
 /**
  *  Update dynamic index buffer.
@@ -707,8 +1242,9 @@ BGFX_C_API void bgfx_destroy_dynamic_vertex_buffer(bgfx_dynamic_vertex_buffer_ha
  *  Returns true if internal transient index buffer has enough space.
  *
  *  @param _num Number of indices.
+ *  @param _index32 Set to true for 32-bit indices.
  */
-BGFX_C_API bool bgfx_check_avail_transient_index_buffer(uint32_t _num);
+BGFX_C_API bool bgfx_check_avail_transient_index_buffer(uint32_t _num, bool _index32);
 
 /**
  *  Returns true if internal transient vertex buffer has enough space.
@@ -733,8 +1269,9 @@ BGFX_C_API bool bgfx_check_avail_instance_data_buffer(uint32_t _num, uint16_t _s
  *  @param _numVertices Number of vertices.
  *  @param _decl Vertex declaration.
  *  @param _numIndices Number of indices.
+ *  @param _index32 Set to true for 32-bit indices.
  */
-BGFX_C_API bool bgfx_check_avail_transient_buffers(uint32_t _numVertices, const bgfx_vertex_decl_t* _decl, uint32_t _numIndices);
+BGFX_C_API bool bgfx_check_avail_transient_buffers(uint32_t _numVertices, const bgfx_vertex_decl_t* _decl, uint32_t _numIndices, bool _index32);
 
 /**
  *  Allocate transient index buffer.
@@ -743,13 +1280,14 @@ BGFX_C_API bool bgfx_check_avail_transient_buffers(uint32_t _numVertices, const
  *    for the duration of frame, and it can be reused for multiple draw
  *    calls.
  *  @param _num Number of indices to allocate.
+ *  @param _index32 Set to true for 32-bit indices, requires
+ *    BGFX_CAPS_INDEX32.
  *
  *  NOTE:
- *    1. You must call setIndexBuffer after alloc in order to avoid memory
- *       leak.
- *    2. Only 16-bit index buffer is supported.
+ *    You must call setIndexBuffer after alloc in order to avoid memory
+ *    leak.
  */
-BGFX_C_API void bgfx_alloc_transient_index_buffer(bgfx_transient_index_buffer_t* _tib, uint32_t _num);
+BGFX_C_API void bgfx_alloc_transient_index_buffer(bgfx_transient_index_buffer_t* _tib, uint32_t _num, bool _index32);
 
 /**
  *  Allocate transient vertex buffer.
@@ -772,9 +1310,9 @@ BGFX_C_API void bgfx_alloc_transient_vertex_buffer(bgfx_transient_vertex_buffer_
  *  true.
  *
  *  NOTE:
- *    Only 16-bit index buffer is supported.
+ *    More than 65535 vertices require 32-bit indices.
  */
-BGFX_C_API bool bgfx_alloc_transient_buffers(bgfx_transient_vertex_buffer_t* _tvb, const bgfx_vertex_decl_t* _decl, uint16_t _numVertices, bgfx_transient_index_buffer_t* _tib, uint16_t _numIndices);
+BGFX_C_API bool bgfx_alloc_transient_buffers(bgfx_transient_vertex_buffer_t* _tvb, const bgfx_vertex_decl_t* _decl, uint32_t _numVertices, bgfx_transient_index_buffer_t* _tib, uint32_t _numIndices, bool _index32);
 
 /**
  *  Allocate instance data buffer.
@@ -850,6 +1388,19 @@ BGFX_C_API void bgfx_calc_texture_size(bgfx_texture_info_t* _info, uint16_t _wid
  */
 BGFX_C_API bgfx_texture_handle_t bgfx_create_texture(const bgfx_memory_t* _mem, uint32_t _flags, uint8_t _skip, bgfx_texture_info_t* _info);
 
+/**
+ *  Create texture from DDS, KTX or PVR file. File is memory mapped, and
+ *  renderer reads texture data directly from mapping, which is unmapped
+ *  once texture is created. Skipped mips are never paged in.
+ *
+ *  @param _filePath Path to texture file.
+ *  @param _flags See bgfx_create_texture.
+ *  @param _skip Skip top level mips when parsing texture.
+ *  @param _info Returns parsed texture information.
+ *  @returns Texture handle, invalid if file can't be mapped.
+ */
+BGFX_C_API bgfx_texture_handle_t bgfx_create_texture_from_file(const char* _filePath, uint32_t _flags, uint8_t _skip, bgfx_texture_info_t* _info);
+
 /**
  *  Create 2D texture.
  *
@@ -858,10 +1409,23 @@ BGFX_C_API bgfx_texture_handle_t bgfx_create_texture(const bgfx_memory_t* _mem,
  *  @param _numMips
  *  @param _format
  *  @param _flags
- *  @param _mem
+ *  @param _mem Texture data. With BGFX_TEXTURE_RESIZE flag, BGRA8,
+ *    RGBA16F and RGBA32F textures larger than maxTextureSize are scaled
+ *    down to fit, keeping aspect ratio.
  */
 BGFX_C_API bgfx_texture_handle_t bgfx_create_texture_2d(uint16_t _width, uint16_t _height, uint8_t _numMips, bgfx_texture_format_t _format, uint32_t _flags, const bgfx_memory_t* _mem);
 
+/**
+ *  Create 2D texture, and return size of created texture.
+ *
+ *  @param _info Returns size of created texture. When texture is resized
+ *    with BGFX_TEXTURE_RESIZE flag, updates and readback must use returned
+ *    width, height and number of mips instead of passed ones.
+ *
+ *  See bgfx_create_texture_2d.
+ */
+BGFX_C_API bgfx_texture_handle_t bgfx_create_texture_2d_info(uint16_t _width, uint16_t _height, uint8_t _numMips, bgfx_texture_format_t _format, uint32_t _flags, const bgfx_memory_t* _mem, bgfx_texture_info_t* _info);
+
 /**
  *  Create 3D texture.
  *
@@ -956,6 +1520,34 @@ BGFX_C_API void bgfx_update_texture_cube(bgfx_texture_handle_t _handle, uint8_t
  */
 BGFX_C_API void bgfx_destroy_texture(bgfx_texture_handle_t _handle);
 
+/**
+ *  Returns true when texture is created on render thread. Textures created
+ *  with BGFX_TEXTURE_ASYNC flag are not ready until render thread creates
+ *  them within per-frame upload budget.
+ */
+BGFX_C_API bool bgfx_is_texture_ready(bgfx_texture_handle_t _handle);
+
+/**
+ *  Set per-frame budget for creating BGFX_TEXTURE_ASYNC textures.
+ *
+ *  @param _size Max bytes of texture data created per frame.
+ *  @param _time Max time in microseconds spent per frame.
+ */
+BGFX_C_API void bgfx_set_upload_budget(uint32_t _size, uint32_t _time);
+
+/**
+ *  Set priority of texture created with BGFX_TEXTURE_STREAM flag. Textures
+ *  used in last frame are promoted one mip at the time in order of
+ *  priority, and least recently used ones are demoted to stay in budget.
+ *  Streaming textures can't be updated.
+ */
+BGFX_C_API void bgfx_set_texture_priority(bgfx_texture_handle_t _handle, uint8_t _priority);
+
+/**
+ *  Set memory budget in bytes for BGFX_TEXTURE_STREAM textures.
+ */
+BGFX_C_API void bgfx_set_texture_streaming_budget(uint32_t _size);
+
 /**
  *  Create frame buffer (simple).
  *
@@ -1333,8 +1925,73 @@ BGFX_C_API void bgfx_discard();
  *  @param _filePath Will be passed to CallbackI::screenShot callback.
  *
  *  NOTE:
- *    CallbackI::screenShot must be implemented.
+ *    Without callback, screen shot is written on background thread as QOI
+ *    if _filePath ends with .qoi, otherwise as TGA.
  */
 BGFX_C_API void bgfx_save_screen_shot(const char* _filePath);
 
+/**
+ *  Create texture atlas. Packs many small images into single texture with
+ *  skyline packer.
+ *
+ *  @param _size Width and height of atlas texture.
+ *  @param _format Texture format. Compressed formats are not supported.
+ *  @param _flags Texture flags.
+ *  @param _maxRegions Max number of regions.
+ *  @param _padding Pixels left empty around each region.
+ */
+BGFX_C_API bgfx_atlas_t* bgfx_create_atlas(uint16_t _size, bgfx_texture_format_t _format, uint32_t _flags, uint16_t _maxRegions, uint8_t _padding);
+
+/**
+ *  Destroy texture atlas and its texture.
+ */
+BGFX_C_API void bgfx_destroy_atlas(bgfx_atlas_t* _atlas);
+
+/**
+ *  Add image to atlas. When there is no space left, atlas is defragmented,
+ *  and if that doesn't help least recently used evictable regions not used
+ *  in current frame are evicted.
+ *
+ *  @param _pitch Pitch of image data (bytes). When _pitch is set to
+ *    UINT16_MAX, it will be calculated based on _width.
+ *  @returns Region id, or UINT32_MAX if image doesn't fit.
+ */
+BGFX_C_API uint32_t bgfx_atlas_add(bgfx_atlas_t* _atlas, uint16_t _width, uint16_t _height, const void* _data, uint16_t _pitch, bool _evictable);
+
+/**
+ *  Remove region from atlas.
+ */
+BGFX_C_API void bgfx_atlas_remove(bgfx_atlas_t* _atlas, uint32_t _region);
+
+/**
+ *  Mark region as used in current frame.
+ */
+BGFX_C_API void bgfx_atlas_touch(bgfx_atlas_t* _atlas, uint32_t _region);
+
+/**
+ *  Returns true if region is not removed or evicted.
+ */
+BGFX_C_API bool bgfx_atlas_is_valid(const bgfx_atlas_t* _atlas, uint32_t _region);
+
+/**
+ *  Get normalized texture coordinates of region, top-left u, v and
+ *  bottom-right u, v.
+ */
+BGFX_C_API void bgfx_atlas_get_uv(const bgfx_atlas_t* _atlas, uint32_t _region, float _uv[4]);
+
+/**
+ *  Returns atlas texture.
+ */
+BGFX_C_API bgfx_texture_handle_t bgfx_atlas_get_texture(const bgfx_atlas_t* _atlas);
+
+/**
+ *  Upload changes made since last update.
+ */
+BGFX_C_API void bgfx_atlas_update(bgfx_atlas_t* _atlas);
+
+/**
+ *  Repack all regions. Returns false if regions don't fit in new order.
+ */
+BGFX_C_API bool bgfx_atlas_defragment(bgfx_atlas_t* _atlas);
+
 #endif // BGFX_C99_H_HEADER_GUARD
@@ -166,6 +166,44 @@ namespace bgfx
 		};
 	};
 
+	struct ImageQuality
+	{
+		enum Enum
+		{
+			Fastest, // Bounding box endpoints.
+			Default, // Principal axis endpoints, refined once.
+			Highest, // Principal axis endpoints, refined until error stops decreasing.
+
+			Count
+		};
+	};
+
+	struct ImageFilter
+	{
+		enum Enum
+		{
+			Box,      // Average of covered pixels, nearest when upscaling.
+			Bilinear, // Triangle filter.
+			Mitchell, // Mitchell-Netravali cubic, B = C = 1/3.
+			Lanczos3, // Windowed sinc, sharpest, rings around hard edges.
+
+			Count
+		};
+	};
+
+	struct CaptureFormat
+	{
+		enum Enum
+		{
+			Callback, // Frames are passed to CallbackI capture callbacks.
+			Y4m,      // Single YUV4MPEG2 file.
+			Tga,      // TGA file per frame.
+			Qoi,      // QOI file per frame.
+
+			Count
+		};
+	};
+
 	struct UniformType
 	{
 		enum Enum
@@ -203,8 +241,9 @@ namespace bgfx
 	/// Cached items are currently used only for OpenGL binary shaders.
 	///
 	/// @remarks
-	///   'fatal' callback can be called from any thread. Other callbacks
-	///   are called from the render thread.
+	///   'fatal' callback can be called from any thread. Capture callbacks
+	///   are called from capture thread. Other callbacks are called from
+	///   the render thread.
 	///
 	struct CallbackI
 	{
@@ -326,6 +365,7 @@ namespace bgfx
 		uint32_t size;
 		IndexBufferHandle handle;
 		uint32_t startIndex;
+		bool index32;
 	};
 
 	///
@@ -428,6 +468,37 @@ namespace bgfx
 	/// Unpack vec4 from vertex stream format.
 	void vertexUnpack(float _output[4], Attrib::Enum _attr, const VertexDecl& _decl, const void* _data, uint32_t _index = 0);
 
+	/// Pack array of vectors into vertex stream format.
+	///
+	/// @param _input Input array, _inputNum floats per vertex.
+	/// @param _inputNum Number of floats per vertex in input array.
+	/// @param _inputNormalized Input is normalized, same as in vertexPack.
+	/// @param _attr Attribute to pack.
+	/// @param _decl Vertex stream declaration.
+	/// @param _data Destination vertex stream.
+	/// @param _num Number of vertices to pack.
+	/// @param _index Index of first destination vertex.
+	///
+	/// @remarks
+	///   Attribute is packed with the same kernels as vertexConvert. Use
+	///   it to fill interleaved vertex stream (e.g. TransientVertexBuffer)
+	///   from separate position, color, etc. arrays.
+	///
+	void vertexPackArray(const float* _input, uint8_t _inputNum, bool _inputNormalized, Attrib::Enum _attr, const VertexDecl& _decl, void* _data, uint32_t _num, uint32_t _index = 0);
+
+	/// Unpack array of vectors from vertex stream format.
+	///
+	/// @param _output Output array, _outputNum floats per vertex. Components
+	///   missing in vertex stream are set to zero.
+	/// @param _outputNum Number of floats per vertex in output array.
+	/// @param _attr Attribute to unpack.
+	/// @param _decl Vertex stream declaration.
+	/// @param _data Source vertex stream.
+	/// @param _num Number of vertices to unpack.
+	/// @param _index Index of first source vertex.
+	///
+	void vertexUnpackArray(float* _output, uint8_t _outputNum, Attrib::Enum _attr, const VertexDecl& _decl, const void* _data, uint32_t _num, uint32_t _index = 0);
+
 	/// Converts vertex stream data from one vertex stream format to another.
 	///
 	/// @param _destDecl Destination vertex stream declaration.
@@ -436,8 +507,98 @@ namespace bgfx
 	/// @param _srcData Source vertex stream data.
 	/// @param _num Number of vertices to convert from source to destination.
 	///
+	/// @remarks
+	///   Conversion kernels are selected once per declaration pair and
+	///   cached, large vertex streams are converted on multiple threads.
+	///
 	void vertexConvert(const VertexDecl& _destDecl, void* _destData, const VertexDecl& _srcDecl, const void* _srcData, uint32_t _num = 1);
 
+	/// Bounds of vertex positions.
+	struct VertexBounds
+	{
+		float min[3];    //!< Bounding box minimum.
+		float max[3];    //!< Bounding box maximum.
+		float center[3]; //!< Bounding sphere center, same as bounding box center.
+		float radius;    //!< Bounding sphere radius.
+	};
+
+	/// Calculate bounding box and bounding sphere of Attrib::Position
+	/// stream. Position can be of any attribute type.
+	///
+	/// @param _decl Vertex stream declaration.
+	/// @param _vertices Vertex stream.
+	/// @param _numVertices Number of vertices.
+	/// @returns Bounds, all zero when there are no positions.
+	///
+	/// @remarks
+	///   Large vertex streams are processed on multiple threads.
+	///
+	VertexBounds calcVertexBounds(const VertexDecl& _decl, const void* _vertices, uint32_t _numVertices);
+
+	/// Calculate tangent frames of triangle list from Attrib::Position,
+	/// Attrib::Normal and Attrib::TexCoord0, and write them to
+	/// Attrib::Tangent and Attrib::Bitangent. Vertex stream is unchanged
+	/// if declaration doesn't have all of position, normal, texture
+	/// coordinate and tangent.
+	///
+	/// @param _vertices Vertex stream.
+	/// @param _numVertices Number of vertices.
+	/// @param _decl Vertex stream declaration.
+	/// @param _indices Triangle list indices.
+	/// @param _numIndices Number of indices.
+	/// @param _index32 Indices are 32-bit, otherwise 16-bit.
+	///
+	/// @remarks
+	///   Tangent is orthogonalized against normal, and its w is
+	///   handedness, so that bitangent is `cross(normal, tangent.xyz)*w`.
+	///   Optional bitangent is written the same way. Large vertex streams
+	///   are processed on multiple threads.
+	///
+	void calcTangents(void* _vertices, uint32_t _numVertices, const VertexDecl& _decl, const void* _indices, uint32_t _numIndices, bool _index32);
+
+	/// Position dequantization of quantized vertex stream.
+	struct VertexQuantization
+	{
+		float scale[3]; //!< Position is `position.xyz*scale + bias`.
+		float bias[3];  //!< Center of position bounds.
+	};
+
+	/// Create compact vertex declaration for quantizeVertices. Only float
+	/// attributes are quantized, other attributes are copied.
+	///
+	/// @param _destDecl Quantized vertex stream declaration.
+	/// @param _srcDecl Source vertex stream declaration.
+	///
+	/// @remarks
+	///   - Position is normalized 4x Int16 relative to position bounds,
+	///     with w set to 1. See: `bgfx::VertexQuantization`.
+	///   - Normal, Tangent and Bitangent are octahedral encoded into
+	///     normalized 2x Int16. With 4 components, w is stored in z of
+	///     4x Int16.
+	///   - Color0, Color1 and Weight are normalized 4x Uint8.
+	///   - TexCoord* are 2x or 4x Half.
+	///
+	///   Int16 attributes are signed normalized. Position must be
+	///   dequantized and octahedral vectors decoded in vertex shader.
+	///
+	void quantizeVertexDecl(VertexDecl& _destDecl, const VertexDecl& _srcDecl);
+
+	/// Quantize vertex stream.
+	///
+	/// @param _destDecl Quantized vertex stream declaration, created with
+	///   quantizeVertexDecl from _srcDecl.
+	/// @param _destData Quantized vertex stream.
+	/// @param _srcDecl Source vertex stream declaration.
+	/// @param _srcData Source vertex stream.
+	/// @param _num Number of vertices.
+	/// @returns Position dequantization.
+	///
+	/// @remarks
+	///   Values are rounded to nearest, large vertex streams are quantized
+	///   on multiple threads.
+	///
+	VertexQuantization quantizeVertices(const VertexDecl& _destDecl, void* _destData, const VertexDecl& _srcDecl, const void* _srcData, uint32_t _num);
+
 	/// Weld vertices.
 	///
 	/// @param _output Welded vertices remapping table. The size of buffer
@@ -450,6 +611,331 @@ namespace bgfx
 	///
 	uint16_t weldVertices(uint16_t* _output, const VertexDecl& _decl, const void* _data, uint16_t _num, float _epsilon = 0.001f);
 
+	/// Weld vertices of large vertex stream.
+	///
+	/// @param _output Welded vertices remapping table, index of each vertex
+	///   in compacted vertex stream. The size of buffer must be the same as
+	///   number of vertices.
+	/// @param _dstData Compacted vertex stream with unique vertices, in order
+	///   of first occurrence. Can be NULL when only remapping table is needed.
+	/// @param _decl Vertex stream declaration.
+	/// @param _data Vertex stream.
+	/// @param _num Number of vertices in vertex stream.
+	/// @param _epsilon Error tolerance for vertex position comparison, and
+	///   for each component of additional attributes.
+	/// @param _attribs Additional attributes (f.e. normal, texture coordinates)
+	///   that must match for vertices to be welded.
+	/// @param _numAttribs Number of additional attributes.
+	/// @returns Number of unique vertices after vertex welding.
+	///
+	/// @remarks
+	///   Vertices are bucketed in grid with epsilon sized cells, and each
+	///   vertex is welded to first unique vertex within epsilon.
+	///
+	uint32_t weldVertices(uint32_t* _output, void* _dstData, const VertexDecl& _decl, const void* _data, uint32_t _num, float _epsilon = 0.001f, const Attrib::Enum* _attribs = NULL, uint8_t _numAttribs = 0);
+
+	/// Returns average cache miss ratio (ACMR), number of vertex shader
+	/// invocations per triangle, of triangle list for FIFO post-transform
+	/// vertex cache.
+	///
+	/// @param _indices Triangle list indices.
+	/// @param _numIndices Number of indices.
+	/// @param _index32 Indices are 32-bit, otherwise 16-bit.
+	/// @param _cacheSize Number of vertex cache entries, up to 64.
+	///
+	float vertexCacheMissRatio(const void* _indices, uint32_t _numIndices, bool _index32, uint32_t _cacheSize = 16);
+
+	/// Reorder triangles for post-transform vertex cache locality. Uses
+	/// Tom Forsyth's linear-speed vertex cache optimisation.
+	///
+	/// @param _dst Reordered indices, can be the same as _indices.
+	/// @param _indices Triangle list indices.
+	/// @param _numIndices Number of indices.
+	/// @param _index32 Indices are 32-bit, otherwise 16-bit.
+	/// @param _numVertices Number of vertices referenced by indices. When
+	///   any index is out of range, indices are copied unchanged.
+	///
+	void optimizeVertexCache(void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, uint32_t _numVertices);
+
+	/// Reorder clusters of vertex cache optimized triangles to reduce
+	/// overdraw. Clusters facing away from mesh center are drawn first.
+	///
+	/// @param _dst Reordered indices, can be the same as _indices.
+	/// @param _indices Triangle list indices, already optimized with
+	///   optimizeVertexCache.
+	/// @param _numIndices Number of indices.
+	/// @param _index32 Indices are 32-bit, otherwise 16-bit.
+	/// @param _decl Vertex stream declaration.
+	/// @param _vertices Vertex stream.
+	/// @param _threshold Allowed ACMR increase, triangle list is split into
+	///   more clusters with higher threshold (f.e. 1.05 allows 5% increase).
+	///
+	void optimizeOverdraw(void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, float _threshold = 1.05f);
+
+	/// Reorder vertices in order of first use by indices, and remap indices
+	/// in place. Vertices not referenced by indices are removed.
+	///
+	/// @param _dstVertices Reordered vertex stream, must not overlap with
+	///   _vertices.
+	/// @param _indices Triangle list indices, remapped in place.
+	/// @param _numIndices Number of indices.
+	/// @param _index32 Indices are 32-bit, otherwise 16-bit.
+	/// @param _decl Vertex stream declaration.
+	/// @param _vertices Vertex stream.
+	/// @param _numVertices Number of vertices in vertex stream.
+	/// @returns Number of vertices written to _dstVertices, 0 when any index
+	///   is out of range.
+	///
+	uint32_t optimizeVertexFetch(void* _dstVertices, void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, uint32_t _numVertices);
+
+	/// Mesh optimization report.
+	struct MeshOptimizeStats
+	{
+		float acmrBefore;     //!< ACMR before optimization, for 16 entry cache.
+		float acmrAfter;      //!< ACMR after optimization, for 16 entry cache.
+		uint32_t numVertices; //!< Number of vertices after optimization.
+	};
+
+	/// Optimize mesh for vertex cache, overdraw and vertex fetch, in that
+	/// order.
+	///
+	/// @param _dstVertices Reordered vertex stream, must not overlap with
+	///   _vertices.
+	/// @param _indices Triangle list indices, reordered and remapped in
+	///   place.
+	/// @param _numIndices Number of indices.
+	/// @param _index32 Indices are 32-bit, otherwise 16-bit.
+	/// @param _decl Vertex stream declaration.
+	/// @param _vertices Vertex stream.
+	/// @param _numVertices Number of vertices in vertex stream.
+	/// @param _overdrawThreshold See: `bgfx::optimizeOverdraw`.
+	/// @returns ACMR before and after optimization. When any index is out
+	///   of range, mesh is unchanged and number of vertices is 0.
+	///
+	MeshOptimizeStats optimizeMesh(void* _dstVertices, void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, uint32_t _numVertices, float _overdrawThreshold = 1.05f);
+
+	/// Simplify triangle list with quadric error metric edge collapses.
+	/// Vertices are not modified, simplified indices reference subset of
+	/// original vertices.
+	///
+	/// @param _dst Simplified indices, can be the same as _indices.
+	/// @param _indices Triangle list indices.
+	/// @param _numIndices Number of indices.
+	/// @param _index32 Indices are 32-bit, otherwise 16-bit.
+	/// @param _decl Vertex stream declaration.
+	/// @param _vertices Vertex stream.
+	/// @param _numVertices Number of vertices in vertex stream.
+	/// @param _targetIndices Target number of indices.
+	/// @param _maxError Maximum error, relative to largest extent of mesh
+	///   bounds.
+	/// @param _attribs Attributes whose squared difference is added to
+	///   collapse error.
+	/// @param _numAttribs Number of attributes in _attribs.
+	/// @param _error Resulting error, relative to largest extent of mesh
+	///   bounds.
+	/// @returns Number of indices written to _dst, 0 when any index is out
+	///   of range.
+	///
+	/// @remarks
+	///   Vertices with same position are collapsed together, so attribute
+	///   seams are kept. Mesh border and non-manifold edges are preserved.
+	///
+	uint32_t simplifyMesh(void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, uint32_t _numVertices, uint32_t _targetIndices, float _maxError = 1.0f, const Attrib::Enum* _attribs = NULL, uint8_t _numAttribs = 0, float* _error = NULL);
+
+	/// Mesh level of detail.
+	struct MeshLod
+	{
+		uint32_t startIndex; //!< First index of LOD.
+		uint32_t numIndices; //!< Number of indices of LOD.
+		float error;         //!< Error relative to largest extent of mesh bounds.
+	};
+
+	/// Generate mesh LOD chain. LOD 0 is original mesh, each following LOD
+	/// is simplified to _ratio of previous LOD triangles.
+	///
+	/// @param _lods LODs, sorted from most detailed.
+	/// @param _maxLods Maximum number of LODs.
+	/// @param _dst Indices of all LODs, can be the same as _indices.
+	/// @param _maxIndices Maximum number of indices in _dst.
+	/// @param _indices Triangle list indices.
+	/// @param _numIndices Number of indices.
+	/// @param _index32 Indices are 32-bit, otherwise 16-bit.
+	/// @param _decl Vertex stream declaration.
+	/// @param _vertices Vertex stream.
+	/// @param _numVertices Number of vertices in vertex stream.
+	/// @param _ratio Ratio of triangles of each LOD to previous LOD.
+	/// @param _attribs See: `bgfx::simplifyMesh`.
+	/// @param _numAttribs Number of attributes in _attribs.
+	/// @returns Number of LODs written to _lods.
+	///
+	/// @remarks
+	///   LOD chain ends when mesh can't be simplified further, or when
+	///   next LOD doesn't fit into _dst.
+	///
+	uint8_t generateMeshLods(MeshLod* _lods, uint8_t _maxLods, void* _dst, uint32_t _maxIndices, const void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, uint32_t _numVertices, float _ratio = 0.5f, const Attrib::Enum* _attribs = NULL, uint8_t _numAttribs = 0);
+
+	/// Select least detailed LOD whose error is within _pixelError on
+	/// screen.
+	///
+	/// @param _lods LODs, sorted from most detailed.
+	/// @param _numLods Number of LODs.
+	/// @param _screenSize Largest extent of mesh bounds projected on
+	///   screen in pixels, f.e. `extent*proj[5]*height*0.5f/distance`.
+	/// @param _pixelError Maximum error in pixels.
+	/// @returns LOD index.
+	///
+	uint8_t selectMeshLod(const MeshLod* _lods, uint8_t _numLods, float _screenSize, float _pixelError = 1.0f);
+
+	/// Meshlet, range of triangle list with bounds for culling.
+	struct Meshlet
+	{
+		uint32_t startIndex; //!< First index of meshlet.
+		uint32_t numIndices; //!< Number of indices of meshlet.
+		float center[3];     //!< Bounding sphere center.
+		float radius;        //!< Bounding sphere radius.
+		float coneAxis[3];   //!< Average triangle normal.
+		float coneCutoff;    //!< Sine of normal cone half angle, 1 when meshlet can't be backface culled.
+	};
+
+	/// Partition triangle list into meshlets with at most _maxVertices
+	/// unique vertices and _maxTriangles triangles. Triangles are
+	/// reordered so that each meshlet is consecutive range of indices.
+	///
+	/// @param _meshlets Meshlets, up to number of triangles. Can be NULL
+	///   to only count meshlets.
+	/// @param _dst Reordered indices, can be the same as _indices.
+	/// @param _indices Triangle list indices.
+	/// @param _numIndices Number of indices.
+	/// @param _index32 Indices are 32-bit, otherwise 16-bit.
+	/// @param _decl Vertex stream declaration.
+	/// @param _vertices Vertex stream.
+	/// @param _numVertices Number of vertices in vertex stream.
+	/// @param _maxVertices Maximum number of unique vertices per meshlet.
+	/// @param _maxTriangles Maximum number of triangles per meshlet.
+	/// @returns Number of meshlets, 0 when any index is out of range.
+	///
+	/// @remarks
+	///   Each meshlet grows from first remaining triangle by adding
+	///   adjacent triangles with fewest new vertices, closest to meshlet
+	///   center.
+	///
+	uint32_t buildMeshlets(Meshlet* _meshlets, void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, uint32_t _numVertices, uint32_t _maxVertices = 64, uint32_t _maxTriangles = 124);
+
+	/// Write indices of meshlets inside view frustum and not facing away
+	/// from eye.
+	///
+	/// @param _dst Indices of visible meshlets, can be NULL to only count
+	///   indices.
+	/// @param _meshlets Meshlets.
+	/// @param _numMeshlets Number of meshlets.
+	/// @param _indices Triangle list indices meshlets were built from.
+	/// @param _index32 Indices are 32-bit, otherwise 16-bit.
+	/// @param _mtx Model view projection matrix.
+	/// @param _eye Eye position in model space, or NULL to skip backface
+	///   culling.
+	/// @returns Number of indices of visible meshlets.
+	///
+	uint32_t cullMeshlets(void* _dst, const Meshlet* _meshlets, uint32_t _numMeshlets, const void* _indices, bool _index32, const float* _mtx, const float* _eye = NULL);
+
+	/// Allocate transient index buffer with indices of visible meshlets.
+	///
+	/// @param[out] _tib Transient index buffer with visible indices. It's
+	///   not allocated when no meshlet is visible, or when there is not
+	///   enough space left in transient index buffer.
+	/// @param _meshlets Meshlets.
+	/// @param _numMeshlets Number of meshlets.
+	/// @param _indices Triangle list indices meshlets were built from.
+	/// @param _index32 Indices are 32-bit, otherwise 16-bit.
+	/// @param _mtx Model view projection matrix.
+	/// @param _eye Eye position in model space, or NULL to skip backface
+	///   culling.
+	/// @returns Number of indices allocated in _tib.
+	///
+	/// @remarks
+	///   See: `bgfx::allocTransientIndexBuffer`.
+	///
+	uint32_t allocTransientMeshlets(TransientIndexBuffer* _tib, const Meshlet* _meshlets, uint32_t _numMeshlets, const void* _indices, bool _index32, const float* _mtx, const float* _eye = NULL);
+
+	/// Mesh group, range of triangle list with bounds.
+	struct MeshGroup
+	{
+		uint32_t startIndex; //!< First index of group.
+		uint32_t numIndices; //!< Number of indices of group.
+		float center[3];     //!< Bounding sphere center.
+		float radius;        //!< Bounding sphere radius.
+		float min[3];        //!< Bounding box minimum.
+		float max[3];        //!< Bounding box maximum.
+	};
+
+	/// Mesh container contents. Groups, LODs and meshlets are ranges of
+	/// indices, so indices of all LODs and meshlets are stored together.
+	struct MeshData
+	{
+		VertexDecl decl;          //!< Vertex stream declaration.
+		const void* vertices;     //!< Vertex stream.
+		uint32_t numVertices;     //!< Number of vertices.
+		const void* indices;      //!< Triangle list indices.
+		uint32_t numIndices;      //!< Number of indices.
+		bool index32;             //!< Indices are 32-bit, otherwise 16-bit.
+		const MeshGroup* groups;  //!< Groups.
+		uint32_t numGroups;       //!< Number of groups.
+		const MeshLod* lods;      //!< LODs, can be NULL.
+		uint32_t numLods;         //!< Number of LODs.
+		const Meshlet* meshlets;  //!< Meshlets, can be NULL.
+		uint32_t numMeshlets;     //!< Number of meshlets.
+	};
+
+	/// Write mesh container.
+	///
+	/// @param _data Destination memory, or NULL to get size of container.
+	/// @param _size Size of destination memory.
+	/// @param _mesh Mesh contents. Only index ranges of groups are used,
+	///   bounds are computed from vertices. Mesh without groups is
+	///   written with single group of all indices.
+	/// @returns Size of container, or 0 if _size is too small.
+	///
+	/// @remarks
+	///   Container starts with header and serialized vertex declaration,
+	///   followed by vertices, indices, groups, LODs and meshlets, each
+	///   aligned to 16 bytes.
+	///
+	uint32_t writeMesh(void* _data, uint32_t _size, const MeshData& _mesh);
+
+	/// Parse mesh container, nothing is copied.
+	///
+	/// @param[out] _mesh Mesh contents, pointing into _data.
+	/// @param _data Mesh container.
+	/// @param _size Size of mesh container.
+	/// @returns True if container is valid.
+	///
+	bool parseMesh(MeshData* _mesh, const void* _data, uint32_t _size);
+
+	/// Mesh loaded from file.
+	struct Mesh
+	{
+		MeshData data;          //!< Contents, pointing into file mapping.
+		VertexBufferHandle vbh; //!< Vertex buffer.
+		IndexBufferHandle ibh;  //!< Index buffer.
+		void* mapping;          //!< File mapping.
+	};
+
+	/// Load mesh container file. File is memory mapped, and buffers are
+	/// created from references into mapping, so mesh data is never copied.
+	///
+	/// @param[out] _mesh Loaded mesh. Contents stay valid until
+	///   `bgfx::destroyMesh` is called.
+	/// @param _filePath Path to mesh file.
+	/// @returns True if mesh is loaded.
+	///
+	/// @remarks
+	///   File is unmapped once mesh is destroyed and both buffers are
+	///   created by renderer.
+	///
+	bool loadMesh(Mesh* _mesh, const char* _filePath);
+
+	/// Destroy mesh buffers and release file mapping.
+	void destroyMesh(Mesh* _mesh);
+
 	/// Swizzle RGBA8 image to BGRA8.
 	///
 	/// @param _width Width of input image (pixels).
@@ -472,6 +958,87 @@ namespace bgfx
 	///
 	void imageRgba8Downsample2x2(uint32_t _width, uint32_t _height, uint32_t _pitch, const void* _src, void* _dst);
 
+	/// Generate mip chain with 2x2 (2x2x2 for 3D textures) box filter.
+	///
+	/// @param _width Width of top level (pixels).
+	/// @param _height Height of top level (pixels).
+	/// @param _depth Depth of top level, 0 or 1 for 2D and cube textures.
+	/// @param _numSides Number of sides, 6 for cube textures, otherwise 1.
+	/// @param _numMips Number of mips in generated chain.
+	/// @param _format Texture format. Supported formats are BGRA8,
+	///   RGBA16F and RGBA32F.
+	/// @param _srgb Filter BGRA8 color channels in linear space.
+	/// @param _src Top level of each side.
+	/// @param _dst Destination for all mips of each side, laid out the same
+	///   way as texture memory passed to createTexture*. Top level is copied
+	///   from _src. When _numSides is 1, _dst might be pointer to the same
+	///   memory as _src.
+	/// @returns False if format is not supported.
+	///
+	bool imageGenerateMips(uint16_t _width, uint16_t _height, uint16_t _depth, uint8_t _numSides, uint8_t _numMips, TextureFormat::Enum _format, bool _srgb, const void* _src, void* _dst);
+
+	/// Resize image to arbitrary size with separable filter.
+	///
+	/// @param _dst Destination image, _dstWidth*_dstHeight pixels. Must not
+	///   overlap _src.
+	/// @param _dstWidth Width of destination image (pixels).
+	/// @param _dstHeight Height of destination image (pixels).
+	/// @param _src Source image.
+	/// @param _srcWidth Width of source image (pixels).
+	/// @param _srcHeight Height of source image (pixels).
+	/// @param _format Format of both images. Supported formats are BGRA8,
+	///   RGBA16F and RGBA32F.
+	/// @param _srcPitch Pitch of source image (bytes). When _srcPitch is
+	///   set to UINT32_MAX, it will be calculated based on _srcWidth.
+	/// @param _filter Resampling filter.
+	/// @param _srgb Filter BGRA8 color channels in linear space.
+	/// @returns False if format is not supported.
+	///
+	/// @remarks
+	///   Filter is widened when downscaling so every source pixel
+	///   contributes, up to 512 source pixels per destination pixel along
+	///   each axis. Pixels outside of source image are not sampled. Image
+	///   of the same size is copied without filtering.
+	///
+	bool imageResize(void* _dst, uint32_t _dstWidth, uint32_t _dstHeight, const void* _src, uint32_t _srcWidth, uint32_t _srcHeight, TextureFormat::Enum _format, uint32_t _srcPitch = UINT32_MAX, ImageFilter::Enum _filter = ImageFilter::Mitchell, bool _srgb = false);
+
+	/// Encode BGRA8 image to block compressed format.
+	///
+	/// @param _dst Destination image, must hold ((_width+3)/4)*((_height+3)/4)
+	///   blocks. Edge blocks of images not multiple of 4 replicate last row
+	///   and column.
+	/// @param _src Source image.
+	/// @param _width Width of input image (pixels).
+	/// @param _height Height of input image (pixels).
+	/// @param _pitch Pitch of input image (bytes).
+	/// @param _format Destination format, BC1, BC3, BC4 or BC5. Channels
+	///   are read from the same bytes imageDecodeToBgra8 decodes them to.
+	/// @param _quality Encoding quality vs speed.
+	/// @returns False if format is not supported.
+	///
+	bool imageEncodeFromBgra8(void* _dst, const void* _src, uint32_t _width, uint32_t _height, uint32_t _pitch, TextureFormat::Enum _format, ImageQuality::Enum _quality = ImageQuality::Default);
+
+	/// Convert image between uncompressed texture formats.
+	///
+	/// @param _dst Destination image, _width*_height pixels of _dstFormat.
+	///   Must not overlap _src.
+	/// @param _dstFormat Destination format.
+	/// @param _src Source image.
+	/// @param _srcFormat Source format.
+	/// @param _width Width of image (pixels).
+	/// @param _height Height of image (pixels).
+	/// @param _srcPitch Pitch of source image (bytes). When _srcPitch is
+	///   set to UINT32_MAX, it will be calculated based on _width.
+	/// @param _premultiply Multiply color channels with alpha.
+	/// @returns False if conversion is not supported. Compressed, depth and
+	///   R1 formats are not supported.
+	///
+	/// @remarks
+	///   Channels missing in source format are read as 0, and alpha as 1.
+	///   Integer formats (R32, RG32, RGBA32) convert values, not normalized.
+	///
+	bool imageConvert(void* _dst, TextureFormat::Enum _dstFormat, const void* _src, TextureFormat::Enum _srcFormat, uint32_t _width, uint32_t _height, uint32_t _srcPitch = UINT32_MAX, bool _premultiply = false);
+
 	/// Returns supported backend API renderers.
 	uint8_t getSupportedRenderers(RendererType::Enum _enum[RendererType::Count]);
 
@@ -510,12 +1077,36 @@ namespace bgfx
 	///   - `BGFX_RESET_FULLSCREEN` - Not supported yet.
 	///   - `BGFX_RESET_MSAA_X[2/4/8/16]` - Enable 2, 4, 8 or 16 x MSAA.
 	///   - `BGFX_RESET_VSYNC` - Enable V-Sync.
-	///   - `BGFX_RESET_CAPTURE` - Begin screen capture.
+	///   - `BGFX_RESET_CAPTURE` - Begin screen capture. Frames are passed
+	///     to capture callbacks or written to file set by
+	///     `bgfx::setCapture`, on background thread. Frames are dropped
+	///     when it can't keep up.
 	///
 	/// @attention C99 equivalent is `bgfx_reset`.
 	///
 	void reset(uint32_t _width, uint32_t _height, uint32_t _flags = BGFX_RESET_NONE);
 
+	/// Set destination of frames captured with `BGFX_RESET_CAPTURE`. It's
+	/// used by next capture started after call to `bgfx::frame`.
+	///
+	/// @param _format `CaptureFormat::Callback` passes frames to
+	///   `bgfx::CallbackI` capture callbacks, on capture thread instead of
+	///   render thread. Other formats are written to _filePath. Default is
+	///   `CaptureFormat::Callback`, and without callback capture is ignored.
+	/// @param _filePath File path. Frame number and extension are appended
+	///   for formats with file per frame.
+	///
+	/// @attention C99 equivalent is `bgfx_set_capture`.
+	///
+	void setCapture(CaptureFormat::Enum _format, const char* _filePath = NULL);
+
+	/// Returns number of frames dropped by current or last capture, as of
+	/// last call to `bgfx::frame`.
+	///
+	/// @attention C99 equivalent is `bgfx_get_capture_num_dropped`.
+	///
+	uint32_t getCaptureNumDropped();
+
 	/// Advance to next frame. When using multithreaded renderer, this call
 	/// just swaps internal buffers, kicks render thread, and returns. In
 	/// singlethreaded renderer this call does frame rendering.
@@ -554,10 +1145,15 @@ namespace bgfx
 	/// Allocate buffer and copy data into it. Data will be freed inside bgfx.
 	const Memory* copy(const void* _data, uint32_t _size);
 
+	/// Called when memory made with `bgfx::makeRef` is released. It might be
+	/// called from any thread.
+	typedef void (*ReleaseFn)(void* _ptr, void* _userData);
+
 	/// Make reference to data to pass to bgfx. Unlike `bgfx::alloc` this call
 	/// doesn't allocate memory for data. It just copies pointer to data. You
-	/// must make sure data is available for at least 2 `bgfx::frame` calls.
-	const Memory* makeRef(const void* _data, uint32_t _size);
+	/// must make sure data is available for at least 2 `bgfx::frame` calls,
+	/// or until _releaseFn is called when it's specified.
+	const Memory* makeRef(const void* _data, uint32_t _size, ReleaseFn _releaseFn = NULL, void* _userData = NULL);
 
 	/// Set debug flags.
 	///
@@ -580,10 +1176,13 @@ namespace bgfx
 
 	/// Create static index buffer.
 	///
-	/// @remarks
-	///   Only 16-bit index buffer is supported.
+	/// @param _mem Index buffer data.
+	/// @param _flags Buffer creation flags.
+	///   - `BGFX_BUFFER_NONE` - 16-bit indices.
+	///   - `BGFX_BUFFER_INDEX32` - 32-bit indices, requires
+	///     `BGFX_CAPS_INDEX32`.
 	///
-	IndexBufferHandle createIndexBuffer(const Memory* _mem);
+	IndexBufferHandle createIndexBuffer(const Memory* _mem, uint16_t _flags = BGFX_BUFFER_NONE);
 
 	/// Destroy static index buffer.
 	void destroyIndexBuffer(IndexBufferHandle _handle);
@@ -605,20 +1204,16 @@ namespace bgfx
 	/// Create empty dynamic index buffer.
 	///
 	/// @param _num Number of indices.
+	/// @param _flags Buffer creation flags, see createIndexBuffer.
 	///
-	/// @remarks
-	///   Only 16-bit index buffer is supported.
-	///
-	DynamicIndexBufferHandle createDynamicIndexBuffer(uint32_t _num);
+	DynamicIndexBufferHandle createDynamicIndexBuffer(uint32_t _num, uint16_t _flags = BGFX_BUFFER_NONE);
 
 	/// Create dynamic index buffer and initialized it.
 	///
 	/// @param _mem Index buffer data.
+	/// @param _flags Buffer creation flags, see createIndexBuffer.
 	///
-	/// @remarks
-	///   Only 16-bit index buffer is supported.
-	///
-	DynamicIndexBufferHandle createDynamicIndexBuffer(const Memory* _mem);
+	DynamicIndexBufferHandle createDynamicIndexBuffer(const Memory* _mem, uint16_t _flags = BGFX_BUFFER_NONE);
 
 	/// Update dynamic index buffer.
 	///
@@ -656,8 +1251,9 @@ namespace bgfx
 	/// Returns true if internal transient index buffer has enough space.
 	///
 	/// @param _num Number of indices.
+	/// @param _index32 Set to true for 32-bit indices.
 	///
-	bool checkAvailTransientIndexBuffer(uint32_t _num);
+	bool checkAvailTransientIndexBuffer(uint32_t _num, bool _index32 = false);
 
 	/// Returns true if internal transient vertex buffer has enough space.
 	///
@@ -679,8 +1275,9 @@ namespace bgfx
 	/// @param _numVertices Number of vertices.
 	/// @param _decl Vertex declaration.
 	/// @param _numIndices Number of indices.
+	/// @param _index32 Set to true for 32-bit indices.
 	///
-	bool checkAvailTransientBuffers(uint32_t _numVertices, const VertexDecl& _decl, uint32_t _numIndices);
+	bool checkAvailTransientBuffers(uint32_t _numVertices, const VertexDecl& _decl, uint32_t _numIndices, bool _index32 = false);
 
 	/// Allocate transient index buffer.
 	///
@@ -688,13 +1285,14 @@ namespace bgfx
 	///   for the duration of frame, and it can be reused for multiple draw
 	///   calls.
 	/// @param _num Number of indices to allocate.
+	/// @param _index32 Set to true for 32-bit indices, requires
+	///   `BGFX_CAPS_INDEX32`.
 	///
 	/// @remarks
-	///   1. You must call setIndexBuffer after alloc in order to avoid memory
-	///      leak.
-	///   2. Only 16-bit index buffer is supported.
+	///   You must call setIndexBuffer after alloc in order to avoid memory
+	///   leak.
 	///
-	void allocTransientIndexBuffer(TransientIndexBuffer* _tib, uint32_t _num);
+	void allocTransientIndexBuffer(TransientIndexBuffer* _tib, uint32_t _num, bool _index32 = false);
 
 	/// Allocate transient vertex buffer.
 	///
@@ -715,9 +1313,9 @@ namespace bgfx
 	/// true.
 	///
 	/// @remarks
-	///   Only 16-bit index buffer is supported.
+	///   More than 65535 vertices require 32-bit indices.
 	///
-	bool allocTransientBuffers(TransientVertexBuffer* _tvb, const VertexDecl& _decl, uint16_t _numVertices, TransientIndexBuffer* _tib, uint16_t _numIndices);
+	bool allocTransientBuffers(TransientVertexBuffer* _tvb, const VertexDecl& _decl, uint32_t _numVertices, TransientIndexBuffer* _tib, uint32_t _numIndices, bool _index32 = false);
 
 	/// Allocate instance data buffer.
 	///
@@ -779,6 +1377,18 @@ namespace bgfx
 	///
 	TextureHandle createTexture(const Memory* _mem, uint32_t _flags = BGFX_TEXTURE_NONE, uint8_t _skip = 0, TextureInfo* _info = NULL);
 
+	/// Create texture from DDS, KTX or PVR file. File is memory mapped, and
+	/// renderer reads texture data directly from mapping, which is unmapped
+	/// once texture is created. Skipped mips are never paged in.
+	///
+	/// @param[in] _filePath Path to texture file.
+	/// @param[in] _flags See `bgfx::createTexture`.
+	/// @param[in] _skip Skip top level mips when parsing texture.
+	/// @param[out] _info When non-`NULL` is specified it returns parsed texture information.
+	/// @returns Texture handle, invalid if file can't be mapped.
+	///
+	TextureHandle createTextureFromFile(const char* _filePath, uint32_t _flags = BGFX_TEXTURE_NONE, uint8_t _skip = 0, TextureInfo* _info = NULL);
+
 	/// Create 2D texture.
 	///
 	/// @param _width
@@ -786,10 +1396,30 @@ namespace bgfx
 	/// @param _numMips
 	/// @param _format
 	/// @param _flags
-	/// @param _mem
+	/// @param _mem Texture data. When _numMips is greater than 1 and _mem
+	///   contains only top level, mip chain is generated on worker
+	///   thread (see imageGenerateMips). Use `BGFX_TEXTURE_MIPS_SRGB` flag
+	///   to filter sRGB data in linear space. With `BGFX_TEXTURE_RESIZE`
+	///   flag, BGRA8, RGBA16F and RGBA32F textures larger than
+	///   `Caps::maxTextureSize` are scaled down on worker thread to fit,
+	///   keeping aspect ratio (see imageResize), and mip chain is generated
+	///   from resized top level. Use createTexture2DInfo to get size of
+	///   resized texture.
 	///
 	TextureHandle createTexture2D(uint16_t _width, uint16_t _height, uint8_t _numMips, TextureFormat::Enum _format, uint32_t _flags = BGFX_TEXTURE_NONE, const Memory* _mem = NULL);
 
+	/// Create 2D texture, and return size of created texture.
+	///
+	/// @param _info Returns size of created texture. When texture is
+	///   resized with `BGFX_TEXTURE_RESIZE` flag, updateTexture2D and
+	///   readback must use returned width, height and number of mips
+	///   instead of passed ones.
+	///
+	/// @remarks
+	///   See: `bgfx::createTexture2D`.
+	///
+	TextureHandle createTexture2DInfo(uint16_t _width, uint16_t _height, uint8_t _numMips, TextureFormat::Enum _format, uint32_t _flags, const Memory* _mem, TextureInfo* _info);
+
 	/// Create 3D texture.
 	///
 	/// @param _width
@@ -798,7 +1428,10 @@ namespace bgfx
 	/// @param _numMips
 	/// @param _format
 	/// @param _flags
-	/// @param _mem
+	/// @param _mem Texture data. When _numMips is greater than 1 and _mem
+	///   contains only top level, mip chain is generated on worker
+	///   thread (see imageGenerateMips). Use `BGFX_TEXTURE_MIPS_SRGB` flag
+	///   to filter sRGB data in linear space.
 	///
 	TextureHandle createTexture3D(uint16_t _width, uint16_t _height, uint16_t _depth, uint8_t _numMips, TextureFormat::Enum _format, uint32_t _flags = BGFX_TEXTURE_NONE, const Memory* _mem = NULL);
 
@@ -808,7 +1441,10 @@ namespace bgfx
 	/// @param _numMips
 	/// @param _format
 	/// @param _flags
-	/// @param _mem
+	/// @param _mem Texture data. When _numMips is greater than 1 and _mem
+	///   contains only top level of each side, mip chain is generated on worker
+	///   thread (see imageGenerateMips). Use `BGFX_TEXTURE_MIPS_SRGB` flag
+	///   to filter sRGB data in linear space.
 	///
 	TextureHandle createTextureCube(uint16_t _size, uint8_t _numMips, TextureFormat::Enum _format, uint32_t _flags = BGFX_TEXTURE_NONE, const Memory* _mem = NULL);
 
@@ -824,6 +1460,9 @@ namespace bgfx
 	/// @param _pitch Pitch of input image (bytes). When _pitch is set to
 	///   UINT16_MAX, it will be calculated internally based on _width.
 	///
+	/// @remarks
+	///   Textures created with `BGFX_TEXTURE_STREAM` can't be updated.
+	///
 	void updateTexture2D(TextureHandle _handle, uint8_t _mip, uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height, const Memory* _mem, uint16_t _pitch = UINT16_MAX);
 
 	/// Update 3D texture.
@@ -877,6 +1516,52 @@ namespace bgfx
 	/// Destroy texture.
 	void destroyTexture(TextureHandle _handle);
 
+	/// Returns true when texture is created on render thread.
+	///
+	/// @remarks
+	///   Textures created with BGFX_TEXTURE_ASYNC flag are created by render
+	///   thread within per-frame upload budget, and are not ready until then.
+	///   Until texture is ready, draw calls are submitted with its sampler
+	///   unbound. Textures created without BGFX_TEXTURE_ASYNC flag are
+	///   always ready.
+	///
+	bool isTextureReady(TextureHandle _handle);
+
+	/// Set per-frame budget for creating BGFX_TEXTURE_ASYNC textures.
+	///
+	/// @param _size Max bytes of texture data created per frame.
+	/// @param _time Max time in microseconds spent per frame.
+	///
+	/// @remarks
+	///   At least one pending texture is created each frame.
+	///
+	void setUploadBudget(uint32_t _size, uint32_t _time);
+
+	/// Set priority of texture created with `BGFX_TEXTURE_STREAM` flag.
+	///
+	/// Streaming textures are created only with mips not larger than
+	/// `BGFX_CONFIG_TEXTURE_STREAM_MIN_SIZE`. Textures used in last frame
+	/// are promoted one mip at the time over following frames, in order of
+	/// priority, by recreating them with one more mip. Least recently used
+	/// textures are demoted, by recreating them with one mip less, when
+	/// promotion would exceed budget.
+	///
+	/// @remarks
+	///   Streaming textures can't be updated, updates are ignored.
+	///
+	/// @param _handle Texture handle.
+	/// @param _priority Priority, higher values are promoted first.
+	///   Default is 0.
+	///
+	void setTexturePriority(TextureHandle _handle, uint8_t _priority);
+
+	/// Set memory budget for `BGFX_TEXTURE_STREAM` textures.
+	///
+	/// @param _size Max bytes of texture storage. Default is
+	///   `BGFX_CONFIG_TEXTURE_STREAM_BUDGET`.
+	///
+	void setTextureStreamingBudget(uint32_t _size);
+
 	/// Create frame buffer (simple).
 	///
 	/// @param _width Texture width.
@@ -1213,10 +1898,105 @@ namespace bgfx
 	/// @param _filePath Will be passed to `bgfx::CallbackI::screenShot` callback.
 	///
 	/// @remarks
-	///   `bgfx::CallbackI::screenShot` must be implemented.
+	///   Without callback, screen shot is written on background thread as
+	///   QOI if _filePath ends with `.qoi`, otherwise as TGA.
 	///
 	void saveScreenShot(const char* _filePath);
 
+	/// Texture atlas. Packs many small images into single texture with
+	/// skyline packer, so they share one texture handle and draws using
+	/// them can be batched.
+	///
+	/// Pixels are kept in CPU copy of atlas texture, and changes are
+	/// uploaded with single `bgfx::updateTexture2D` of their bounding
+	/// rectangle on `bgfx::Atlas::update` call.
+	///
+	/// @remarks
+	///   Library must be initialized. Only uncompressed color formats are
+	///   supported.
+	///
+	class Atlas
+	{
+	public:
+		/// @param _size Width and height of atlas texture.
+		/// @param _format Texture format.
+		/// @param _flags Texture flags.
+		/// @param _maxRegions Max number of regions.
+		/// @param _padding Pixels left empty around each region.
+		///
+		Atlas(uint16_t _size, TextureFormat::Enum _format = TextureFormat::BGRA8, uint32_t _flags = BGFX_TEXTURE_NONE, uint16_t _maxRegions = 4096, uint8_t _padding = 1);
+		~Atlas();
+
+		/// Add image to atlas. When there is no space left, atlas is
+		/// defragmented, and if that doesn't help least recently used
+		/// evictable regions not used in current frame are evicted.
+		///
+		/// @param _width Image width.
+		/// @param _height Image height.
+		/// @param _data Image data, copied into atlas.
+		/// @param _pitch Pitch of image data (bytes). When _pitch is set to
+		///   UINT16_MAX, it will be calculated based on _width.
+		/// @param _evictable Region can be evicted to make space.
+		/// @returns Region id, or UINT32_MAX if image doesn't fit. Image
+		///   larger than atlas is rejected without evicting anything.
+		///
+		uint32_t add(uint16_t _width, uint16_t _height, const void* _data, uint16_t _pitch = UINT16_MAX, bool _evictable = false);
+
+		/// Remove region. Its space is reclaimed by next defragmentation.
+		void remove(uint32_t _region);
+
+		/// Mark region as used in current frame.
+		void touch(uint32_t _region);
+
+		/// Returns true if region is not removed or evicted.
+		bool isValid(uint32_t _region) const;
+
+		/// Get normalized texture coordinates of region.
+		///
+		/// @param[out] _uv Top-left u, v and bottom-right u, v.
+		///
+		/// @remarks
+		///   Regions move when atlas is defragmented, coordinates should be
+		///   queried when used.
+		///
+		void getUv(uint32_t _region, float _uv[4]) const;
+
+		/// Returns atlas texture.
+		TextureHandle getTexture() const { return m_texture; }
+
+		/// Upload changes made since last update.
+		void update();
+
+		/// Repack all regions. Returns false if regions don't fit in new
+		/// order, in which case atlas is unchanged.
+		bool defragment();
+
+	private:
+		struct Region;
+		struct Node;
+
+		bool pack(uint16_t _width, uint16_t _height, uint16_t& _x, uint16_t& _y);
+		bool evict();
+		void markDirty(uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height);
+
+		TextureHandle m_texture;
+		uint8_t* m_data;
+		Region* m_regions;
+		Node* m_nodes;
+		uint16_t* m_free;
+		uint32_t m_freedArea;
+		uint16_t m_numNodes;
+		uint16_t m_numFree;
+		uint16_t m_maxRegions;
+		uint16_t m_size;
+		uint16_t m_dirty[4];
+		uint8_t m_bytesPerPixel;
+		uint8_t m_padding;
+
+		Atlas(const Atlas&);
+		void operator=(const Atlas&);
+	};
+
 } // namespace bgfx
 
 #endif // BGFX_H_HEADER_GUARD
@@ -125,6 +125,7 @@ namespace stl
 #endif // BX_PLATFORM_*
 
 #include <bx/cpu.h>
+#include <bx/spscqueue.h>
 #include <bx/thread.h>
 #include <bx/timer.h>
 
@@ -543,6 +544,7 @@ namespace bgfx
 			CreateProgram,
 			CreateTexture,
 			UpdateTexture,
+			StreamTexture,
 			CreateFrameBuffer,
 			CreateUniform,
 			UpdateViewName,
@@ -1021,6 +1023,7 @@ namespace bgfx
 			m_numInstances = 1;
 			m_num = 1;
 			m_scissor = UINT16_MAX;
+			m_index32 = false;
 			m_vertexBuffer.idx = invalidHandle;
 			m_vertexDecl.idx = invalidHandle;
 			m_indexBuffer.idx = invalidHandle;
@@ -1048,6 +1051,7 @@ namespace bgfx
 		uint16_t m_numInstances;
 		uint16_t m_num;
 		uint16_t m_scissor;
+		bool m_index32;
 
 		VertexBufferHandle m_vertexBuffer;
 		VertexDeclHandle   m_vertexDecl;
@@ -1124,6 +1128,7 @@ namespace bgfx
 		IndexBufferHandle m_handle;
 		uint32_t m_offset;
 		uint32_t m_size;
+		uint16_t m_flags;
 	};
 
 	struct DynamicVertexBuffer
@@ -1137,6 +1142,519 @@ namespace bgfx
 		VertexDeclHandle m_decl;
 	};
 
+	// Handle allocator with tables growing in GrowT chunks up to MaxHandlesT.
+	// Handles are never remapped, growing only appends new free handles, so
+	// existing handles stay valid.
+	template <uint16_t MaxHandlesT, uint16_t GrowT = 256>
+	class HandleAllocGrowT
+	{
+	public:
+		static const uint16_t invalid = 0xffff;
+
+		BX_STATIC_ASSERT(MaxHandlesT < invalid);
+
+		HandleAllocGrowT()
+			: m_dense(NULL)
+			, m_sparse(NULL)
+			, m_numHandles(0)
+			, m_capacity(0)
+		{
+		}
+
+		~HandleAllocGrowT()
+		{
+			if (NULL != m_dense)
+			{
+				BX_FREE(g_allocator, m_dense);
+			}
+		}
+
+		const uint16_t* getHandles() const
+		{
+			return m_dense;
+		}
+
+		uint16_t getHandleAt(uint16_t _at) const
+		{
+			return m_dense[_at];
+		}
+
+		uint16_t getNumHandles() const
+		{
+			return m_numHandles;
+		}
+
+		uint16_t getMaxHandles() const
+		{
+			return MaxHandlesT;
+		}
+
+		uint16_t getCapacity() const
+		{
+			return m_capacity;
+		}
+
+		uint16_t alloc()
+		{
+			if (m_numHandles == m_capacity
+			&&  !grow() )
+			{
+				return invalid;
+			}
+
+			uint16_t index = m_numHandles;
+			++m_numHandles;
+
+			uint16_t handle = m_dense[index];
+			m_sparse[handle] = index;
+			return handle;
+		}
+
+		void free(uint16_t _handle)
+		{
+			BX_CHECK(0 < m_numHandles, "Freeing invalid handle %d.", _handle);
+			uint16_t index = m_sparse[_handle];
+			--m_numHandles;
+			uint16_t temp = m_dense[m_numHandles];
+			m_dense[m_numHandles] = _handle;
+			m_sparse[temp] = index;
+			m_dense[index] = temp;
+		}
+
+	private:
+		bool grow()
+		{
+			if (MaxHandlesT <= m_capacity)
+			{
+				return false;
+			}
+
+			const uint16_t capacity = uint16_t(bx::uint32_min(m_capacity + GrowT, MaxHandlesT) );
+			uint16_t* dense  = (uint16_t*)BX_ALLOC(g_allocator, 2*capacity*sizeof(uint16_t) );
+			uint16_t* sparse = &dense[capacity];
+
+			if (NULL != m_dense)
+			{
+				memcpy(dense,  m_dense,  m_capacity*sizeof(uint16_t) );
+				memcpy(sparse, m_sparse, m_capacity*sizeof(uint16_t) );
+				BX_FREE(g_allocator, m_dense);
+			}
+
+			for (uint16_t ii = m_capacity; ii < capacity; ++ii)
+			{
+				dense[ii] = ii;
+			}
+
+			m_dense    = dense;
+			m_sparse   = sparse;
+			m_capacity = capacity;
+
+			return true;
+		}
+
+		uint16_t* m_dense;
+		uint16_t* m_sparse;
+		uint16_t m_numHandles;
+		uint16_t m_capacity;
+	};
+
+	// Per-frame list of handles, e.g. handles released during frame. Storage
+	// grows to the peak number of handles in a single frame instead of being
+	// sized for the maximum number of handles.
+	template <typename HandleT>
+	class HandleListT
+	{
+	public:
+		HandleListT()
+			: m_handles(NULL)
+			, m_num(0)
+			, m_size(0)
+		{
+		}
+
+		~HandleListT()
+		{
+			if (NULL != m_handles)
+			{
+				BX_FREE(g_allocator, m_handles);
+			}
+		}
+
+		void push(HandleT _handle)
+		{
+			if (m_num == m_size)
+			{
+				m_size = bx::uint32_max(m_size*2, 64);
+				m_handles = (HandleT*)BX_REALLOC(g_allocator, m_handles, m_size*sizeof(HandleT) );
+			}
+
+			m_handles[m_num] = _handle;
+			++m_num;
+		}
+
+		HandleT get(uint32_t _idx) const
+		{
+			return m_handles[_idx];
+		}
+
+		uint32_t getNum() const
+		{
+			return m_num;
+		}
+
+		void reset()
+		{
+			m_num = 0;
+		}
+
+	private:
+		HandleT* m_handles;
+		uint32_t m_num;
+		uint32_t m_size;
+	};
+
+	// Textures created with BGFX_TEXTURE_ASYNC, waiting to be created by
+	// render thread within per-frame upload budget.
+	struct UploadQueue
+	{
+		struct Item
+		{
+			TextureHandle m_handle;
+			Memory* m_mem;
+			uint32_t m_flags;
+			uint8_t m_skip;
+		};
+
+		void init()
+		{
+			m_head = 0;
+			m_tail = 0;
+			memset(m_index, 0xff, sizeof(m_index) );
+		}
+
+		bool isEmpty() const
+		{
+			return m_head == m_tail;
+		}
+
+		bool isFull() const
+		{
+			return BGFX_CONFIG_MAX_TEXTURES == m_tail - m_head;
+		}
+
+		bool isPending(uint16_t _idx) const
+		{
+			return UINT16_MAX != m_index[_idx];
+		}
+
+		void push(TextureHandle _handle, Memory* _mem, uint32_t _flags, uint8_t _skip)
+		{
+			BX_CHECK(!isFull(), "Upload queue is full.");
+			const uint16_t slot = uint16_t(m_tail % BGFX_CONFIG_MAX_TEXTURES);
+			Item& item = m_items[slot];
+			item.m_handle = _handle;
+			item.m_mem    = _mem;
+			item.m_flags  = _flags;
+			item.m_skip   = _skip;
+			m_index[_handle.idx] = slot;
+			++m_tail;
+		}
+
+		bool pop(Item& _item)
+		{
+			while (!isEmpty() )
+			{
+				const Item& item = m_items[m_head % BGFX_CONFIG_MAX_TEXTURES];
+				++m_head;
+
+				if (isValid(item.m_handle) )
+				{
+					_item = item;
+					m_index[item.m_handle.idx] = UINT16_MAX;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		void remove(uint16_t _idx, Item& _item)
+		{
+			Item& item = m_items[m_index[_idx] ];
+			_item = item;
+			item.m_handle.idx = invalidHandle;
+			m_index[_idx] = UINT16_MAX;
+		}
+
+		uint32_t m_head;
+		uint32_t m_tail;
+		Item m_items[BGFX_CONFIG_MAX_TEXTURES];
+		uint16_t m_index[BGFX_CONFIG_MAX_TEXTURES];
+	};
+
+	// Decodes textures in formats emulated by renderer (caps value 2) to
+	// BGRA8, resizes BGFX_TEXTURE_RESIZE textures larger than
+	// maxTextureSize, and generates mip chains for textures created with
+	// only top level supplied, on worker thread, so render thread receives
+	// data ready to be uploaded.
+	class TextureDecoder
+	{
+	public:
+		TextureDecoder();
+
+		void shutdown();
+
+		// API thread. Returns NULL if texture doesn't need to be decoded,
+		// otherwise returns texture create chunk which will receive decoded
+		// data. Skipped mips are not decoded, and _skip is set to 0. _format
+		// is set to emulated format when data is decoded to BGRA8, otherwise
+		// to TextureFormat::Unknown.
+		const Memory* decode(const Memory* _mem, uint8_t& _skip, uint32_t _flags, TextureFormat::Enum& _format);
+
+		// API thread. Returns memory which will receive update of texture
+		// created from emulated format, decoded to BGRA8. Takes ownership
+		// of _mem, and sets _pitch to UINT16_MAX.
+		const Memory* decodeUpdate(const Memory* _mem, uint16_t _width, uint16_t _height, uint16_t& _pitch, TextureFormat::Enum _format);
+
+		// Render thread. Waits for oldest decode to finish.
+		void wait();
+
+	private:
+		struct Job
+		{
+			const Memory* m_src;
+			const Memory* m_dst;
+			uint16_t m_width;
+			uint16_t m_height;
+			uint16_t m_pitch;
+			uint8_t m_numMips;
+			uint8_t m_startLod;
+			uint8_t m_format;
+			bool m_resize;
+			bool m_generateMips;
+			bool m_srgb;
+			bool m_update;
+		};
+
+		const Memory* resize(const Memory* _mem, const TextureCreate& _tc, uint32_t _flags);
+		const Memory* generateMips(const Memory* _mem, const TextureCreate& _tc, uint32_t _flags);
+		void push(const Job& _job);
+
+		static void execute(const Job& _job);
+
+#if BGFX_CONFIG_MULTITHREADED
+		static int32_t threadFunc(void* _userData);
+
+		bx::SpScBlockingUnboundedQueue<Job> m_jobs;
+		bx::Semaphore m_done;
+		bx::Thread m_thread;
+#endif // BGFX_CONFIG_MULTITHREADED
+	};
+
+	// Keeps source data of BGFX_TEXTURE_STREAM textures and picks first mip
+	// each of them is created with. Textures are created with smallest mips
+	// first, recently used ones are promoted one mip at the time by
+	// priority, and least recently used ones are demoted to stay within
+	// budget. Renderer recreates texture with resident mips only, so budget
+	// bounds texture storage.
+	class TextureStreamer
+	{
+	public:
+		TextureStreamer();
+
+		void shutdown();
+
+		// Returns false if texture can't be streamed. Otherwise takes
+		// ownership of _mem.
+		bool create(TextureHandle _handle, const Memory* _mem, uint32_t _flags, uint8_t _skip);
+
+		void destroy(TextureHandle _handle);
+
+		bool isStreaming(TextureHandle _handle) const
+		{
+			return NULL != m_textures[_handle.idx].m_source;
+		}
+
+		void touch(TextureHandle _handle, uint32_t _frame)
+		{
+			if (isValid(_handle) )
+			{
+				m_textures[_handle.idx].m_lastUsed = _frame;
+			}
+		}
+
+		void setPriority(TextureHandle _handle, uint8_t _priority)
+		{
+			m_textures[_handle.idx].m_priority = _priority;
+		}
+
+		void setBudget(uint32_t _size)
+		{
+			m_budget = _size;
+		}
+
+		// Returns reference to source data, valid until released, and flags
+		// and skip texture must be created with.
+		const Memory* makeRef(TextureHandle _handle, uint32_t& _flags, uint8_t& _skip);
+
+		// Picks textures to promote or demote. Returns number of textures
+		// which changed start mip, see getChange.
+		uint32_t update(uint32_t _frame);
+
+		TextureHandle getChange(uint32_t _idx) const
+		{
+			TextureHandle handle = { m_changes[_idx] };
+			return handle;
+		}
+
+	private:
+		struct Source
+		{
+			const Memory* m_mem;
+			int32_t m_refCount;
+		};
+
+		struct Texture
+		{
+			Source* m_source;
+			uint32_t m_flags;
+			uint32_t m_lastUsed;
+			uint32_t m_changed;
+			uint16_t m_width;
+			uint16_t m_height;
+			uint16_t m_listIdx;
+			uint8_t m_format;
+			uint8_t m_numSides;
+			uint8_t m_numMips;
+			uint8_t m_skip;
+			uint8_t m_minSkip;
+			uint8_t m_maxSkip;
+			uint8_t m_priority;
+		};
+
+		static void releaseSource(void* _ptr, void* _userData);
+
+		uint32_t getSize(const Texture& _texture, uint8_t _skip) const;
+		uint16_t findVictim(const Texture* _candidate) const;
+		void setSkip(uint16_t _idx, uint8_t _skip, uint32_t _frame);
+
+		Texture m_textures[BGFX_CONFIG_MAX_TEXTURES];
+		uint16_t m_list[BGFX_CONFIG_MAX_TEXTURES];
+		uint16_t m_changes[BGFX_CONFIG_MAX_TEXTURES];
+		uint16_t m_num;
+		uint16_t m_numChanges;
+		uint32_t m_size;
+		uint32_t m_budget;
+	};
+
+	// Sits between renderers and capture callbacks. Copies screenshots and
+	// captured frames into ring of buffers, which are passed to callback, or
+	// encoded and written to files, on capture thread. Captured frames are
+	// dropped when all buffers are in use.
+	class CaptureWriter
+	{
+	public:
+		CaptureWriter();
+
+		// Sets whether captured frames can be passed to user callback.
+		void init(bool _callback);
+
+		// Writes all queued images and closes capture file.
+		void shutdown();
+
+		// Sets destination of next capture. Called on API thread while
+		// render thread waits.
+		void setCapture(CaptureFormat::Enum _format, const char* _filePath);
+
+		// Format is picked by .tga or .qoi file extension, otherwise .tga
+		// is appended to file path.
+		void screenShot(const char* _filePath, uint32_t _width, uint32_t _height, uint32_t _pitch, const void* _data, bool _yflip);
+
+		// Called by renderers instead of CallbackI capture callbacks. Y4M
+		// captures are written to single file, other formats to file per
+		// frame with frame number appended to file path.
+		void captureBegin(uint32_t _width, uint32_t _height, uint32_t _pitch, TextureFormat::Enum _format, bool _yflip);
+
+		// Returns false if frame is dropped.
+		bool captureFrame(const void* _data, uint32_t _size);
+
+		void captureEnd();
+
+		uint32_t getNumDropped() const
+		{
+			return m_numDropped;
+		}
+
+	private:
+		struct Kind
+		{
+			enum Enum
+			{
+				ScreenShot,
+				Begin,
+				Frame,
+				End,
+				Quit,
+			};
+		};
+
+		// Image data is followed by file path.
+		struct Slot
+		{
+			uint8_t* m_data;
+			uint32_t m_capacity;
+			uint32_t m_size;
+			uint32_t m_width;
+			uint32_t m_height;
+			uint32_t m_pitch;
+			uint8_t m_kind;
+			uint8_t m_format;
+			uint8_t m_textureFormat;
+			bool m_yflip;
+		};
+
+		Slot* acquire(bool _wait);
+		void reserve(Slot& _slot, uint32_t _size);
+		void submit();
+		void execute(const Slot& _slot);
+		uint8_t* scratch(uint32_t _size);
+
+		static int32_t threadFunc(void* _userData);
+
+		Slot m_slots[BGFX_CONFIG_CAPTURE_BUFFERS];
+		uint32_t m_write;
+		uint32_t m_read;
+
+		// Capture state, API side.
+		char m_capturePath[256];
+		uint8_t m_captureFormat;
+		bool m_callback;
+
+		// Capture state, render side. Format is CaptureFormat::Count when
+		// not capturing.
+		uint32_t m_width;
+		uint32_t m_height;
+		uint32_t m_numFrames;
+		uint32_t m_numDropped;
+		uint8_t m_format;
+		bool m_yflip;
+
+		// Capture state, writer side.
+		bx::FileWriterI* m_writer;
+		uint8_t* m_scratch;
+		uint32_t m_scratchSize;
+		uint32_t m_frame;
+		char m_filePath[256];
+
+#if BX_CONFIG_SUPPORTS_THREADING
+		bx::Semaphore m_free;
+		bx::Semaphore m_work;
+		bx::Thread m_thread;
+#endif // BX_CONFIG_SUPPORTS_THREADING
+	};
+
+	extern CaptureWriter g_captureWriter;
+
 	struct Frame
 	{
 		BX_CACHE_LINE_ALIGN_MARKER();
@@ -1264,11 +1782,12 @@ namespace bgfx
 			m_draw.m_num    = _num;
 		}
 
-		void setIndexBuffer(IndexBufferHandle _handle, uint32_t _firstIndex, uint32_t _numIndices)
+		void setIndexBuffer(IndexBufferHandle _handle, uint32_t _firstIndex, uint32_t _numIndices, bool _index32)
 		{
 			m_draw.m_startIndex  = _firstIndex;
 			m_draw.m_numIndices  = _numIndices;
 			m_draw.m_indexBuffer = _handle;
+			m_draw.m_index32     = _index32;
 		}
 
 		void setIndexBuffer(const TransientIndexBuffer* _tib, uint32_t _firstIndex, uint32_t _numIndices)
@@ -1276,6 +1795,7 @@ namespace bgfx
 			m_draw.m_indexBuffer = _tib->handle;
 			m_draw.m_startIndex  = _firstIndex;
 			m_draw.m_numIndices  = _numIndices;
+			m_draw.m_index32     = _tib->index32;
 			m_discard = 0 == _numIndices;
 		}
 
@@ -1361,21 +1881,21 @@ namespace bgfx
 		uint32_t dispatch(uint8_t _id, ProgramHandle _handle, uint16_t _ngx, uint16_t _ngy, uint16_t _ngz);
 		void sort();
 
-		bool checkAvailTransientIndexBuffer(uint32_t _num)
+		bool checkAvailTransientIndexBuffer(uint32_t _num, uint16_t _indexSize)
 		{
-			uint32_t offset = m_iboffset;
-			uint32_t iboffset = offset + _num*sizeof(uint16_t);
+			uint32_t offset = strideAlign(m_iboffset, _indexSize);
+			uint32_t iboffset = offset + _num*_indexSize;
 			iboffset = bx::uint32_min(iboffset, BGFX_CONFIG_TRANSIENT_INDEX_BUFFER_SIZE);
-			uint32_t num = (iboffset-offset)/sizeof(uint16_t);
+			uint32_t num = (iboffset-offset)/_indexSize;
 			return num == _num;
 		}
 
-		uint32_t allocTransientIndexBuffer(uint32_t& _num)
+		uint32_t allocTransientIndexBuffer(uint32_t& _num, uint16_t _indexSize)
 		{
-			uint32_t offset = m_iboffset;
-			m_iboffset = offset + _num*sizeof(uint16_t);
+			uint32_t offset = strideAlign(m_iboffset, _indexSize);
+			m_iboffset = offset + _num*_indexSize;
 			m_iboffset = bx::uint32_min(m_iboffset, BGFX_CONFIG_TRANSIENT_INDEX_BUFFER_SIZE);
-			_num = (m_iboffset-offset)/sizeof(uint16_t);
+			_num = (m_iboffset-offset)/_indexSize;
 			return offset;
 		}
 
@@ -1404,62 +1924,54 @@ namespace bgfx
 
 		void free(IndexBufferHandle _handle)
 		{
-			m_freeIndexBufferHandle[m_numFreeIndexBufferHandles] = _handle;
-			++m_numFreeIndexBufferHandles;
+			m_freeIndexBufferHandle.push(_handle);
 		}
 
 		void free(VertexDeclHandle _handle)
 		{
-			m_freeVertexDeclHandle[m_numFreeVertexDeclHandles] = _handle;
-			++m_numFreeVertexDeclHandles;
+			m_freeVertexDeclHandle.push(_handle);
 		}
 
 		void free(VertexBufferHandle _handle)
 		{
-			m_freeVertexBufferHandle[m_numFreeVertexBufferHandles] = _handle;
-			++m_numFreeVertexBufferHandles;
+			m_freeVertexBufferHandle.push(_handle);
 		}
 
 		void free(ShaderHandle _handle)
 		{
-			m_freeShaderHandle[m_numFreeShaderHandles] = _handle;
-			++m_numFreeShaderHandles;
+			m_freeShaderHandle.push(_handle);
 		}
 
 		void free(ProgramHandle _handle)
 		{
-			m_freeProgramHandle[m_numFreeProgramHandles] = _handle;
-			++m_numFreeProgramHandles;
+			m_freeProgramHandle.push(_handle);
 		}
 
 		void free(TextureHandle _handle)
 		{
-			m_freeTextureHandle[m_numFreeTextureHandles] = _handle;
-			++m_numFreeTextureHandles;
+			m_freeTextureHandle.push(_handle);
 		}
 
 		void free(FrameBufferHandle _handle)
 		{
-			m_freeFrameBufferHandle[m_numFreeFrameBufferHandles] = _handle;
-			++m_numFreeFrameBufferHandles;
+			m_freeFrameBufferHandle.push(_handle);
 		}
 
 		void free(UniformHandle _handle)
 		{
-			m_freeUniformHandle[m_numFreeUniformHandles] = _handle;
-			++m_numFreeUniformHandles;
+			m_freeUniformHandle.push(_handle);
 		}
 
 		void resetFreeHandles()
 		{
-			m_numFreeIndexBufferHandles  = 0;
-			m_numFreeVertexDeclHandles   = 0;
-			m_numFreeVertexBufferHandles = 0;
-			m_numFreeShaderHandles       = 0;
-			m_numFreeProgramHandles      = 0;
-			m_numFreeTextureHandles      = 0;
-			m_numFreeFrameBufferHandles  = 0;
-			m_numFreeUniformHandles      = 0;
+			m_freeIndexBufferHandle.reset();
+			m_freeVertexDeclHandle.reset();
+			m_freeVertexBufferHandle.reset();
+			m_freeShaderHandle.reset();
+			m_freeProgramHandle.reset();
+			m_freeTextureHandle.reset();
+			m_freeFrameBufferHandle.reset();
+			m_freeUniformHandle.reset();
 		}
 
 		SortKey m_key;
@@ -1497,28 +2009,20 @@ namespace bgfx
 
 		Resolution m_resolution;
 		uint32_t m_debug;
+		uint32_t m_uploadBudgetSize;
+		uint32_t m_uploadBudgetTime;
 
 		CommandBuffer m_cmdPre;
 		CommandBuffer m_cmdPost;
 
-		uint16_t m_numFreeIndexBufferHandles;
-		uint16_t m_numFreeVertexDeclHandles;
-		uint16_t m_numFreeVertexBufferHandles;
-		uint16_t m_numFreeShaderHandles;
-		uint16_t m_numFreeProgramHandles;
-		uint16_t m_numFreeTextureHandles;
-		uint16_t m_numFreeFrameBufferHandles;
-		uint16_t m_numFreeUniformHandles;
-		uint16_t m_numFreeWindowHandles;
-
-		IndexBufferHandle m_freeIndexBufferHandle[BGFX_CONFIG_MAX_INDEX_BUFFERS];
-		VertexDeclHandle m_freeVertexDeclHandle[BGFX_CONFIG_MAX_VERTEX_DECLS];
-		VertexBufferHandle m_freeVertexBufferHandle[BGFX_CONFIG_MAX_VERTEX_BUFFERS];
-		ShaderHandle m_freeShaderHandle[BGFX_CONFIG_MAX_SHADERS];
-		ProgramHandle m_freeProgramHandle[BGFX_CONFIG_MAX_PROGRAMS];
-		TextureHandle m_freeTextureHandle[BGFX_CONFIG_MAX_TEXTURES];
-		FrameBufferHandle m_freeFrameBufferHandle[BGFX_CONFIG_MAX_FRAME_BUFFERS];
-		UniformHandle m_freeUniformHandle[BGFX_CONFIG_MAX_UNIFORMS];
+		HandleListT<IndexBufferHandle> m_freeIndexBufferHandle;
+		HandleListT<VertexDeclHandle> m_freeVertexDeclHandle;
+		HandleListT<VertexBufferHandle> m_freeVertexBufferHandle;
+		HandleListT<ShaderHandle> m_freeShaderHandle;
+		HandleListT<ProgramHandle> m_freeProgramHandle;
+		HandleListT<TextureHandle> m_freeTextureHandle;
+		HandleListT<FrameBufferHandle> m_freeFrameBufferHandle;
+		HandleListT<UniformHandle> m_freeUniformHandle;
 		TextVideoMem* m_textVideoMem;
 
 		int64_t m_waitSubmit;
@@ -1539,8 +2043,8 @@ namespace bgfx
 			memset(m_vertexBufferRef, 0xff, sizeof(m_vertexBufferRef) );
 		}
 
-		template <uint16_t MaxHandlesT>
-		void shutdown(bx::HandleAllocT<MaxHandlesT>& _handleAlloc)
+		template <typename HandleAllocT>
+		void shutdown(HandleAllocT& _handleAlloc)
 		{
 			for (VertexDeclMap::iterator it = m_vertexDeclMap.begin(), itEnd = m_vertexDeclMap.end(); it != itEnd; ++it)
 			{
@@ -1699,6 +2203,108 @@ namespace bgfx
 		UsedList m_used;
 	};
 
+	// Linear per-frame scratch allocator. Memory is valid until reset, free
+	// only rewinds the most recent allocation, or releases requests that
+	// didn't fit and went to g_allocator. Block grows at reset to peak usage
+	// of previous frame, so in steady state there is no heap traffic.
+	class FrameAllocator : public bx::AllocatorI
+	{
+	public:
+		FrameAllocator()
+			: m_mem(NULL)
+			, m_size(0)
+			, m_pos(0)
+			, m_last(0)
+			, m_peak(0)
+		{
+		}
+
+		virtual ~FrameAllocator()
+		{
+			BX_CHECK(NULL == m_mem, "FrameAllocator is not shutdown.");
+		}
+
+		void init(uint32_t _size)
+		{
+			m_size = _size;
+			m_mem = (uint8_t*)BX_ALIGNED_ALLOC(g_allocator, m_size, 16);
+			m_pos = 0;
+			m_last = 0;
+			m_peak = 0;
+		}
+
+		void shutdown()
+		{
+			BX_ALIGNED_FREE(g_allocator, m_mem, 16);
+			m_mem = NULL;
+			m_size = 0;
+			m_pos = 0;
+			m_last = 0;
+			m_peak = 0;
+		}
+
+		void reset()
+		{
+			if (m_peak > m_size
+			&&  m_size < BGFX_CONFIG_MAX_FRAME_SCRATCH_SIZE)
+			{
+				BX_ALIGNED_FREE(g_allocator, m_mem, 16);
+				m_size = bx::uint32_min(bx::uint32_nextpow2(m_peak), BGFX_CONFIG_MAX_FRAME_SCRATCH_SIZE);
+				m_mem = (uint8_t*)BX_ALIGNED_ALLOC(g_allocator, m_size, 16);
+			}
+
+			m_pos = 0;
+			m_last = 0;
+			m_peak = 0;
+		}
+
+		virtual void* alloc(size_t _size, size_t _align, const char* _file, uint32_t _line) BX_OVERRIDE
+		{
+			const uint32_t align = bx::uint32_max(uint32_t(_align), BX_CONFIG_ALLOCATOR_NATURAL_ALIGNMENT);
+			const uint32_t size  = uint32_t(_size);
+			const uint32_t pos   = BX_ALIGN_MASK(m_pos, align-1);
+			m_peak = bx::uint32_max(m_peak, pos + size);
+
+			if (pos + size <= m_size)
+			{
+				m_last = m_pos;
+				m_pos = pos + size;
+				return &m_mem[pos];
+			}
+
+			return bx::alloc(g_allocator, _size, _align, _file, _line);
+		}
+
+		virtual void free(void* _ptr, size_t _align, const char* _file, uint32_t _line) BX_OVERRIDE
+		{
+			const uint8_t* ptr = (const uint8_t*)_ptr;
+			if (NULL == ptr)
+			{
+				return;
+			}
+
+			if (ptr < m_mem
+			||  ptr >= &m_mem[m_size])
+			{
+				bx::free(g_allocator, _ptr, _align, _file, _line);
+			}
+			else if (ptr >= &m_mem[m_last])
+			{
+				m_pos = m_last;
+			}
+		}
+
+	private:
+		uint8_t* m_mem;
+		uint32_t m_size;
+		uint32_t m_pos;
+		uint32_t m_last;
+		uint32_t m_peak;
+	};
+
+	// Render thread frame scratch, valid until the end of renderFrame.
+	bx::AllocatorI* getRenderScratch();
+
 	struct BX_NO_VTABLE RendererContextI
 	{
 		virtual ~RendererContextI() = 0;
@@ -1760,12 +2366,18 @@ namespace bgfx
 			, m_numFreeDynamicIndexBufferHandles(0)
 			, m_numFreeDynamicVertexBufferHandles(0)
 			, m_clearColorDirty(0)
+			, m_uploadBudgetSize(BGFX_CONFIG_UPLOAD_BUDGET_SIZE)
+			, m_uploadBudgetTime(BGFX_CONFIG_UPLOAD_BUDGET_TIME)
+			, m_captureFormat(CaptureFormat::Callback)
+			, m_captureDirty(false)
+			, m_captureNumDropped(0)
 			, m_instBufferCount(0)
 			, m_frames(0)
 			, m_debug(BGFX_DEBUG_NONE)
 			, m_rendererInitialized(false)
 			, m_exit(false)
 		{
+			m_capturePath[0] = '\0';
 		}
 
 		~Context()
@@ -1803,6 +2415,19 @@ namespace bgfx
 			memset(m_fb, 0xff, sizeof(m_fb) );
 		}
 
+		BGFX_API_FUNC(void setCapture(CaptureFormat::Enum _format, const char* _filePath) )
+		{
+			BX_CHECK(CaptureFormat::Callback == _format || NULL != _filePath, "Capture format %d requires file path.", _format);
+			m_captureFormat = uint8_t(_format);
+			m_captureDirty  = true;
+			bx::strlcpy(m_capturePath, NULL != _filePath ? _filePath : "", BX_COUNTOF(m_capturePath) );
+		}
+
+		BGFX_API_FUNC(uint32_t getCaptureNumDropped() )
+		{
+			return m_captureNumDropped;
+		}
+
 		BGFX_API_FUNC(void setDebug(uint32_t _debug) )
 		{
 			m_debug = _debug;
@@ -1819,13 +2444,36 @@ namespace bgfx
 			m_submit->m_textVideoMem->printfVargs(_x, _y, _attr, _format, _argList);
 		}
 
-		BGFX_API_FUNC(IndexBufferHandle createIndexBuffer(const Memory* _mem) )
+		BGFX_API_FUNC(IndexBufferHandle createIndexBuffer(const Memory* _mem, uint16_t _flags) )
 		{
+			uint64_t key = 0;
+			uint64_t check = 0;
+			if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+			{
+				key = contentKey(_mem, _flags, check);
+				IndexBufferHandle handle = { m_indexBufferHashMap.find(key, check) };
+				if (isValid(handle) )
+				{
+					++m_indexBufferRef[handle.idx].m_refCount;
+					release(_mem);
+					return handle;
+				}
+			}
+
 			IndexBufferHandle handle = { m_indexBufferHandle.alloc() };
 
 			BX_WARN(isValid(handle), "Failed to allocate index buffer handle.");
 			if (isValid(handle) )
 			{
+				m_indexBufferFlags[handle.idx] = _flags;
+
+				if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+				{
+					m_indexBufferRef[handle.idx].m_key = key;
+					m_indexBufferRef[handle.idx].m_refCount = 1;
+					m_indexBufferHashMap.insert(key, handle.idx, check);
+				}
+
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateIndexBuffer);
 				cmdbuf.write(handle);
 				cmdbuf.write(_mem);
@@ -1836,6 +2484,17 @@ namespace bgfx
 
 		BGFX_API_FUNC(void destroyIndexBuffer(IndexBufferHandle _handle) )
 		{
+			if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+			{
+				ContentRef& ref = m_indexBufferRef[_handle.idx];
+				if (0 != --ref.m_refCount)
+				{
+					return;
+				}
+
+				m_indexBufferHashMap.remove(ref.m_key, _handle.idx);
+			}
+
 			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyIndexBuffer);
 			cmdbuf.write(_handle);
 			m_submit->free(_handle);
@@ -1859,11 +2518,32 @@ namespace bgfx
 
 		BGFX_API_FUNC(VertexBufferHandle createVertexBuffer(const Memory* _mem, const VertexDecl& _decl) )
 		{
+			uint64_t key = 0;
+			uint64_t check = 0;
+			if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+			{
+				key = contentKey(_mem, _decl.m_hash, check);
+				VertexBufferHandle handle = { m_vertexBufferHashMap.find(key, check) };
+				if (isValid(handle) )
+				{
+					++m_vertexBufferRef[handle.idx].m_refCount;
+					release(_mem);
+					return handle;
+				}
+			}
+
 			VertexBufferHandle handle = { m_vertexBufferHandle.alloc() };
 
 			BX_WARN(isValid(handle), "Failed to allocate vertex buffer handle.");
 			if (isValid(handle) )
 			{
+				if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+				{
+					m_vertexBufferRef[handle.idx].m_key = key;
+					m_vertexBufferRef[handle.idx].m_refCount = 1;
+					m_vertexBufferHashMap.insert(key, handle.idx, check);
+				}
+
 				VertexDeclHandle declHandle = findVertexDecl(_decl);
 				m_declRef.add(handle, declHandle, _decl.m_hash);
 
@@ -1878,6 +2558,17 @@ namespace bgfx
 
 		BGFX_API_FUNC(void destroyVertexBuffer(VertexBufferHandle _handle) )
 		{
+			if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+			{
+				ContentRef& ref = m_vertexBufferRef[_handle.idx];
+				if (0 != --ref.m_refCount)
+				{
+					return;
+				}
+
+				m_vertexBufferHashMap.remove(ref.m_key, _handle.idx);
+			}
+
 			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyVertexBuffer);
 			cmdbuf.write(_handle);
 			m_submit->free(_handle);
@@ -1895,10 +2586,11 @@ namespace bgfx
 			m_vertexBufferHandle.free(_handle.idx);
 		}
 
-		BGFX_API_FUNC(DynamicIndexBufferHandle createDynamicIndexBuffer(uint32_t _num) )
+		BGFX_API_FUNC(DynamicIndexBufferHandle createDynamicIndexBuffer(uint32_t _num, uint16_t _flags) )
 		{
 			DynamicIndexBufferHandle handle = BGFX_INVALID_HANDLE;
-			uint32_t size = BX_ALIGN_16(_num*2);
+			const uint32_t indexSize = 0 == (_flags & BGFX_BUFFER_INDEX32) ? 2 : 4;
+			uint32_t size = BX_ALIGN_16(_num*indexSize);
 			uint64_t ptr = m_dynamicIndexBufferAllocator.alloc(size);
 			if (ptr == NonLocalAllocator::invalidBlock)
 			{
@@ -1927,14 +2619,16 @@ namespace bgfx
 			DynamicIndexBuffer& dib = m_dynamicIndexBuffers[handle.idx];
 			dib.m_handle.idx = uint16_t(ptr>>32);
 			dib.m_offset = uint32_t(ptr);
-			dib.m_size = size;
+			dib.m_size = _num*indexSize;
+			dib.m_flags = _flags;
 
 			return handle;
 		}
 
-		BGFX_API_FUNC(DynamicIndexBufferHandle createDynamicIndexBuffer(const Memory* _mem) )
+		BGFX_API_FUNC(DynamicIndexBufferHandle createDynamicIndexBuffer(const Memory* _mem, uint16_t _flags) )
 		{
-			DynamicIndexBufferHandle handle = createDynamicIndexBuffer(_mem->size/2);
+			const uint32_t indexSize = 0 == (_flags & BGFX_BUFFER_INDEX32) ? 2 : 4;
+			DynamicIndexBufferHandle handle = createDynamicIndexBuffer(_mem->size/indexSize, _flags);
 			if (isValid(handle) )
 			{
 				updateDynamicIndexBuffer(handle, _mem);
@@ -2044,9 +2738,9 @@ namespace bgfx
 			m_dynamicVertexBufferHandle.free(_handle.idx);
 		}
 
-		BGFX_API_FUNC(bool checkAvailTransientIndexBuffer(uint32_t _num) const)
+		BGFX_API_FUNC(bool checkAvailTransientIndexBuffer(uint32_t _num, bool _index32) const)
 		{
-			return m_submit->checkAvailTransientIndexBuffer(_num);
+			return m_submit->checkAvailTransientIndexBuffer(_num, _index32 ? 4 : 2);
 		}
 
 		BGFX_API_FUNC(bool checkAvailTransientVertexBuffer(uint32_t _num, uint16_t _stride) const)
@@ -2070,6 +2764,7 @@ namespace bgfx
 				ib->data = (uint8_t*)&ib[1];
 				ib->size = _size;
 				ib->handle = handle;
+				ib->index32 = false;
 			}
 
 			return ib;
@@ -2084,16 +2779,18 @@ namespace bgfx
 			BX_FREE(g_allocator, const_cast<TransientIndexBuffer*>(_ib) );
 		}
 
-		BGFX_API_FUNC(void allocTransientIndexBuffer(TransientIndexBuffer* _tib, uint32_t _num) )
+		BGFX_API_FUNC(void allocTransientIndexBuffer(TransientIndexBuffer* _tib, uint32_t _num, bool _index32) )
 		{
-			uint32_t offset = m_submit->allocTransientIndexBuffer(_num);
+			const uint16_t indexSize = _index32 ? 4 : 2;
+			uint32_t offset = m_submit->allocTransientIndexBuffer(_num, indexSize);
 
 			TransientIndexBuffer& dib = *m_submit->m_transientIb;
 
 			_tib->data = &dib.data[offset];
-			_tib->size = _num * sizeof(uint16_t);
+			_tib->size = _num * indexSize;
 			_tib->handle = dib.handle;
-			_tib->startIndex = offset/sizeof(uint16_t);
+			_tib->startIndex = offset/indexSize;
+			_tib->index32 = _index32;
 		}
 
 		TransientVertexBuffer* createTransientVertexBuffer(uint32_t _size, const VertexDecl* _decl = NULL)
@@ -2202,6 +2899,20 @@ namespace bgfx
 				return invalid;
 			}
 
+			uint64_t key = 0;
+			uint64_t check = 0;
+			if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+			{
+				key = contentKey(_mem, 0, check);
+				ShaderHandle handle = { m_shaderHashMap.find(key, check) };
+				if (isValid(handle) )
+				{
+					shaderIncRef(handle);
+					release(_mem);
+					return handle;
+				}
+			}
+
 			ShaderHandle handle = { m_shaderHandle.alloc() };
 
 			BX_WARN(isValid(handle), "Failed to allocate shader handle.");
@@ -2216,10 +2927,16 @@ namespace bgfx
 				ShaderRef& sr = m_shaderRef[handle.idx];
 				sr.m_refCount = 1;
 				sr.m_hash     = iohash;
+				sr.m_key      = key;
 				sr.m_num      = 0;
 				sr.m_uniforms = NULL;
 
-				UniformHandle* uniforms = (UniformHandle*)alloca(count*sizeof(UniformHandle) );
+				if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+				{
+					m_shaderHashMap.insert(key, handle.idx, check);
+				}
+
+				UniformHandle* uniforms = (UniformHandle*)BX_ALLOC(&m_submitScratch, count*sizeof(UniformHandle) );
 
 				for (uint32_t ii = 0; ii < count; ++ii)
 				{
@@ -2258,6 +2975,8 @@ namespace bgfx
 					memcpy(sr.m_uniforms, uniforms, size);
 				}
 
+				BX_FREE(&m_submitScratch, uniforms);
+
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateShader);
 				cmdbuf.write(handle);
 				cmdbuf.write(_mem);
@@ -2306,6 +3025,11 @@ namespace bgfx
 			int32_t refs = --sr.m_refCount;
 			if (0 == refs)
 			{
+				if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+				{
+					m_shaderHashMap.remove(sr.m_key, _handle.idx);
+				}
+
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyShader);
 				cmdbuf.write(_handle);
 				m_submit->free(_handle);
@@ -2343,6 +3067,17 @@ namespace bgfx
 				return invalid;
 			}
 
+			const uint64_t key = (uint64_t(_vsh.idx)<<16) | _fsh.idx;
+			if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+			{
+				ProgramHandle handle = { m_programHashMap.find(key) };
+				if (isValid(handle) )
+				{
+					++m_programRef[handle.idx].m_refCount;
+					return handle;
+				}
+			}
+
 			ProgramHandle handle;
  			handle.idx = m_programHandle.alloc();
 
@@ -2353,6 +3088,12 @@ namespace bgfx
 				shaderIncRef(_fsh);
 				m_programRef[handle.idx].m_vsh = _vsh;
 				m_programRef[handle.idx].m_fsh = _fsh;
+				m_programRef[handle.idx].m_refCount = 1;
+
+				if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+				{
+					m_programHashMap.insert(key, handle.idx);
+				}
 
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateProgram);
 				cmdbuf.write(handle);
@@ -2372,6 +3113,17 @@ namespace bgfx
 				return invalid;
 			}
 
+			const uint64_t key = (uint64_t(_vsh.idx)<<16) | invalidHandle;
+			if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+			{
+				ProgramHandle handle = { m_programHashMap.find(key) };
+				if (isValid(handle) )
+				{
+					++m_programRef[handle.idx].m_refCount;
+					return handle;
+				}
+			}
+
 			ProgramHandle handle;
 			handle.idx = m_programHandle.alloc();
 
@@ -2380,6 +3132,13 @@ namespace bgfx
 			{
 				shaderIncRef(_vsh);
 				m_programRef[handle.idx].m_vsh = _vsh;
+				m_programRef[handle.idx].m_fsh.idx = invalidHandle;
+				m_programRef[handle.idx].m_refCount = 1;
+
+				if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+				{
+					m_programHashMap.insert(key, handle.idx);
+				}
 
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateProgram);
 				cmdbuf.write(handle);
@@ -2394,12 +3153,26 @@ namespace bgfx
 
 		BGFX_API_FUNC(void destroyProgram(ProgramHandle _handle) )
 		{
+			ProgramRef& pr = m_programRef[_handle.idx];
+			if (0 != --pr.m_refCount)
+			{
+				return;
+			}
+
+			if (BX_ENABLED(BGFX_CONFIG_DEDUPLICATE_RESOURCES) )
+			{
+				m_programHashMap.remove( (uint64_t(pr.m_vsh.idx)<<16) | pr.m_fsh.idx, _handle.idx);
+			}
+
 			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyProgram);
 			cmdbuf.write(_handle);
 			m_submit->free(_handle);
 
-			shaderDecRef(m_programRef[_handle.idx].m_vsh);
-			shaderDecRef(m_programRef[_handle.idx].m_fsh);
+			shaderDecRef(pr.m_vsh);
+			if (isValid(pr.m_fsh) )
+			{
+				shaderDecRef(pr.m_fsh);
+			}
 		}
 
 		BGFX_API_FUNC(TextureHandle createTexture(const Memory* _mem, uint32_t _flags, uint8_t _skip, TextureInfo* _info) )
@@ -2435,17 +3208,115 @@ namespace bgfx
 			{
 				TextureRef& ref = m_textureRef[handle.idx];
 				ref.m_refCount = 1;
+				ref.m_pending  = 0 != (_flags & BGFX_TEXTURE_ASYNC);
+
+				uint8_t skip = _skip;
+
+				if (0 != (_flags & BGFX_TEXTURE_STREAM)
+				&&  m_textureStreamer.create(handle, _mem, _flags, _skip) )
+				{
+					// Streamer keeps source data, and picks mips texture is
+					// created with.
+					_mem = m_textureStreamer.makeRef(handle, _flags, skip);
+					ref.m_pending = false;
+				}
+
+				TextureFormat::Enum decodeFormat;
+				const Memory* decoded = m_textureDecoder.decode(_mem, skip, _flags, decodeFormat);
+				const bool decode = NULL != decoded;
+				ref.m_decodeFormat = uint8_t(decodeFormat);
+
+				if (NULL != _info
+				&&  decode
+				&&  TextureFormat::Unknown == decodeFormat)
+				{
+					// Texture was resized to fit maxTextureSize, report size
+					// of texture renderer creates.
+					ImageContainer imageContainer;
+					if (imageParse(imageContainer, decoded->data, decoded->size)
+					&& (imageContainer.m_width  != _info->width
+					||  imageContainer.m_height != _info->height) )
+					{
+						calcTextureSize(*_info
+							, (uint16_t)imageContainer.m_width
+							, (uint16_t)imageContainer.m_height
+							, _info->depth
+							, imageContainer.m_numMips
+							, _info->format
+							);
+					}
+				}
 
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateTexture);
 				cmdbuf.write(handle);
-				cmdbuf.write(_mem);
+				cmdbuf.write(decode ? decoded : _mem);
 				cmdbuf.write(_flags);
-				cmdbuf.write(_skip);
+				cmdbuf.write(skip);
+				cmdbuf.write(decode);
 			}
 
 			return handle;
 		}
 
+		BGFX_API_FUNC(bool isTextureReady(TextureHandle _handle) )
+		{
+			if (!isValid(_handle) )
+			{
+				BX_WARN(false, "Passing invalid texture handle to bgfx::isTextureReady");
+				return false;
+			}
+
+			return !m_textureRef[_handle.idx].m_pending;
+		}
+
+		BGFX_API_FUNC(void setUploadBudget(uint32_t _size, uint32_t _time) )
+		{
+			m_uploadBudgetSize = _size;
+			m_uploadBudgetTime = _time;
+		}
+
+		BGFX_API_FUNC(void setTexturePriority(TextureHandle _handle, uint8_t _priority) )
+		{
+			if (!isValid(_handle) )
+			{
+				BX_WARN(false, "Passing invalid texture handle to bgfx::setTexturePriority");
+				return;
+			}
+
+			m_textureStreamer.setPriority(_handle, _priority);
+		}
+
+		BGFX_API_FUNC(void setTextureStreamingBudget(uint32_t _size) )
+		{
+			m_textureStreamer.setBudget(_size);
+		}
+
+		void streamTexture(TextureHandle _handle)
+		{
+			uint32_t flags;
+			uint8_t skip;
+			const Memory* mem = m_textureStreamer.makeRef(_handle, flags, skip);
+
+			TextureFormat::Enum decodeFormat;
+			const Memory* decoded = m_textureDecoder.decode(mem, skip, flags, decodeFormat);
+			const bool decode = NULL != decoded;
+
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::StreamTexture);
+			cmdbuf.write(_handle);
+			cmdbuf.write(decode ? decoded : mem);
+			cmdbuf.write(flags);
+			cmdbuf.write(skip);
+			cmdbuf.write(decode);
+		}
+
+		void streamTextures()
+		{
+			for (uint32_t ii = 0, num = m_textureStreamer.update(m_frames); ii < num; ++ii)
+			{
+				streamTexture(m_textureStreamer.getChange(ii) );
+			}
+		}
+
 		BGFX_API_FUNC(void destroyTexture(TextureHandle _handle) )
 		{
 			if (!isValid(_handle) )
@@ -2469,6 +3340,8 @@ namespace bgfx
 			int32_t refs = --ref.m_refCount;
 			if (0 == refs)
 			{
+				m_textureStreamer.destroy(_handle);
+
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyTexture);
 				cmdbuf.write(_handle);
 				m_submit->free(_handle);
@@ -2477,6 +3350,29 @@ namespace bgfx
 
 		BGFX_API_FUNC(void updateTexture(TextureHandle _handle, uint8_t _side, uint8_t _mip, uint16_t _x, uint16_t _y, uint16_t _z, uint16_t _width, uint16_t _height, uint16_t _depth, uint16_t _pitch, const Memory* _mem) )
 		{
+			if (m_textureStreamer.isStreaming(_handle) )
+			{
+				// Streamer recreates texture from source data, update would
+				// be lost when texture is promoted or demoted.
+				BX_WARN(false, "Texture created with BGFX_TEXTURE_STREAM can't be updated.");
+				release(_mem);
+				return;
+			}
+
+			textureUpdate(_handle, _side, _mip, _x, _y, _z, _width, _height, _depth, _pitch, _mem);
+		}
+
+		void textureUpdate(TextureHandle _handle, uint8_t _side, uint8_t _mip, uint16_t _x, uint16_t _y, uint16_t _z, uint16_t _width, uint16_t _height, uint16_t _depth, uint16_t _pitch, const Memory* _mem)
+		{
+			// Renderer received texture already decoded to BGRA8, update
+			// data must be decoded the same way.
+			const TextureFormat::Enum decodeFormat = TextureFormat::Enum(m_textureRef[_handle.idx].m_decodeFormat);
+			const bool decode = TextureFormat::Unknown != decodeFormat;
+			if (decode)
+			{
+				_mem = m_textureDecoder.decodeUpdate(_mem, _width, _height, _pitch, decodeFormat);
+			}
+
 			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::UpdateTexture);
 			cmdbuf.write(_handle);
 			cmdbuf.write(_side);
@@ -2491,6 +3387,7 @@ namespace bgfx
 			cmdbuf.write(_depth);
 			cmdbuf.write(_pitch);
 			cmdbuf.write(_mem);
+			cmdbuf.write(decode);
 		}
 
 		BGFX_API_FUNC(FrameBufferHandle createFrameBuffer(uint8_t _num, TextureHandle* _handles) )
@@ -2797,12 +3694,19 @@ namespace bgfx
 
 		BGFX_API_FUNC(void setIndexBuffer(IndexBufferHandle _handle, uint32_t _firstIndex, uint32_t _numIndices) )
 		{
-			m_submit->setIndexBuffer(_handle, _firstIndex, _numIndices);
+			const bool index32 = isValid(_handle)
+				&& 0 != (m_indexBufferFlags[_handle.idx] & BGFX_BUFFER_INDEX32)
+				;
+			m_submit->setIndexBuffer(_handle, _firstIndex, _numIndices, index32);
 		}
 
 		BGFX_API_FUNC(void setIndexBuffer(DynamicIndexBufferHandle _handle, uint32_t _firstIndex, uint32_t _numIndices) )
 		{
-			m_submit->setIndexBuffer(m_dynamicIndexBuffers[_handle.idx].m_handle, _firstIndex, _numIndices);
+			const DynamicIndexBuffer& dib = m_dynamicIndexBuffers[_handle.idx];
+			const bool index32 = 0 != (dib.m_flags & BGFX_BUFFER_INDEX32);
+			const uint32_t indexSize = index32 ? 4 : 2;
+			const uint32_t numIndices = bx::uint32_min(_numIndices, dib.m_size/indexSize - bx::uint32_min(_firstIndex, dib.m_size/indexSize) );
+			m_submit->setIndexBuffer(dib.m_handle, dib.m_offset/indexSize + _firstIndex, numIndices, index32);
 		}
 
 		BGFX_API_FUNC(void setIndexBuffer(const TransientIndexBuffer* _tib, uint32_t _firstIndex, uint32_t _numIndices) )
@@ -2839,6 +3743,7 @@ namespace bgfx
 
 		BGFX_API_FUNC(void setTexture(uint8_t _stage, UniformHandle _sampler, TextureHandle _handle, uint32_t _flags) )
 		{
+			m_textureStreamer.touch(_handle, m_frames);
 			m_submit->setTexture(_stage, _sampler, _handle, _flags);
 		}
 
@@ -2903,6 +3808,9 @@ namespace bgfx
 		// render thread
 		bool renderFrame();
 		void flushTextureUpdateBatch(CommandBuffer& _cmdbuf);
+		void rendererCreateTexture(TextureHandle _handle, Memory* _mem, uint32_t _flags, uint8_t _skip);
+		void rendererFlushUpload(TextureHandle _handle);
+		void rendererProcessUploads();
 		void rendererExecCommands(CommandBuffer& _cmdbuf);
 
 #if BGFX_CONFIG_MULTITHREADED
@@ -2968,24 +3876,28 @@ namespace bgfx
 		DynamicIndexBufferHandle m_freeDynamicIndexBufferHandle[BGFX_CONFIG_MAX_DYNAMIC_INDEX_BUFFERS];
 		DynamicVertexBufferHandle m_freeDynamicVertexBufferHandle[BGFX_CONFIG_MAX_DYNAMIC_VERTEX_BUFFERS];
 
+		FrameAllocator m_submitScratch;
+		FrameAllocator m_renderScratch;
+
 		NonLocalAllocator m_dynamicIndexBufferAllocator;
-		bx::HandleAllocT<BGFX_CONFIG_MAX_DYNAMIC_INDEX_BUFFERS> m_dynamicIndexBufferHandle;
+		HandleAllocGrowT<BGFX_CONFIG_MAX_DYNAMIC_INDEX_BUFFERS> m_dynamicIndexBufferHandle;
 		NonLocalAllocator m_dynamicVertexBufferAllocator;
-		bx::HandleAllocT<BGFX_CONFIG_MAX_DYNAMIC_VERTEX_BUFFERS> m_dynamicVertexBufferHandle;
+		HandleAllocGrowT<BGFX_CONFIG_MAX_DYNAMIC_VERTEX_BUFFERS> m_dynamicVertexBufferHandle;
 
-		bx::HandleAllocT<BGFX_CONFIG_MAX_INDEX_BUFFERS> m_indexBufferHandle;
-		bx::HandleAllocT<BGFX_CONFIG_MAX_VERTEX_DECLS > m_vertexDeclHandle;
+		HandleAllocGrowT<BGFX_CONFIG_MAX_INDEX_BUFFERS> m_indexBufferHandle;
+		HandleAllocGrowT<BGFX_CONFIG_MAX_VERTEX_DECLS > m_vertexDeclHandle;
 
-		bx::HandleAllocT<BGFX_CONFIG_MAX_VERTEX_BUFFERS> m_vertexBufferHandle;
-		bx::HandleAllocT<BGFX_CONFIG_MAX_SHADERS> m_shaderHandle;
-		bx::HandleAllocT<BGFX_CONFIG_MAX_PROGRAMS> m_programHandle;
-		bx::HandleAllocT<BGFX_CONFIG_MAX_TEXTURES> m_textureHandle;
-		bx::HandleAllocT<BGFX_CONFIG_MAX_FRAME_BUFFERS> m_frameBufferHandle;
-		bx::HandleAllocT<BGFX_CONFIG_MAX_UNIFORMS> m_uniformHandle;
+		HandleAllocGrowT<BGFX_CONFIG_MAX_VERTEX_BUFFERS> m_vertexBufferHandle;
+		HandleAllocGrowT<BGFX_CONFIG_MAX_SHADERS> m_shaderHandle;
+		HandleAllocGrowT<BGFX_CONFIG_MAX_PROGRAMS> m_programHandle;
+		HandleAllocGrowT<BGFX_CONFIG_MAX_TEXTURES> m_textureHandle;
+		HandleAllocGrowT<BGFX_CONFIG_MAX_FRAME_BUFFERS> m_frameBufferHandle;
+		HandleAllocGrowT<BGFX_CONFIG_MAX_UNIFORMS> m_uniformHandle;
 
 		struct ShaderRef
 		{
 			UniformHandle* m_uniforms;
+			uint64_t m_key;
 			uint32_t m_hash;
 			int16_t  m_refCount;
 			uint16_t m_num;
@@ -2995,8 +3907,138 @@ namespace bgfx
 		{
 			ShaderHandle m_vsh;
 			ShaderHandle m_fsh;
+			int16_t m_refCount;
+		};
+
+		struct ContentRef
+		{
+			uint64_t m_key;
+			int16_t m_refCount;
+		};
+
+		// Maps content key to live handle, used when
+		// BGFX_CONFIG_DEDUPLICATE_RESOURCES is enabled. Content is identified
+		// by 128-bit hash, key and check halves, so content itself isn't kept
+		// or compared.
+		class ContentHashMap
+		{
+		public:
+			uint16_t find(uint64_t _key, uint64_t _check = 0) const
+			{
+				Map::const_iterator it = m_map.find(_key);
+				if (it == m_map.end()
+				||  it->second.m_check != _check)
+				{
+					return invalidHandle;
+				}
+
+				return it->second.m_handle;
+			}
+
+			void insert(uint64_t _key, uint16_t _handle, uint64_t _check = 0)
+			{
+				Entry entry;
+				entry.m_check  = _check;
+				entry.m_handle = _handle;
+
+				// If key is taken by different content first entry stays,
+				// and new handle is simply not shared.
+				m_map.insert(stl::make_pair(_key, entry) );
+			}
+
+			void remove(uint64_t _key, uint16_t _handle)
+			{
+				Map::iterator it = m_map.find(_key);
+				if (it != m_map.end()
+				&&  it->second.m_handle == _handle)
+				{
+					m_map.erase(it);
+				}
+			}
+
+			void shutdown()
+			{
+				m_map.clear();
+			}
+
+		private:
+			struct Entry
+			{
+				uint64_t m_check;
+				uint16_t m_handle;
+			};
+
+			typedef stl::unordered_map<uint64_t, Entry> Map;
+			Map m_map;
 		};
 
+		static uint64_t rotl64(uint64_t _a, uint32_t _sa)
+		{
+			return (_a << _sa) | (_a >> (64-_sa) );
+		}
+
+		static uint64_t fmix64(uint64_t _k)
+		{
+			_k ^= _k >> 33;
+			_k *= UINT64_C(0xff51afd7ed558ccd);
+			_k ^= _k >> 33;
+			_k *= UINT64_C(0xc4ceb9fe1a85ec53);
+			_k ^= _k >> 33;
+			return _k;
+		}
+
+		// MurmurHash3 x64 128-bit hash of content. Returns first half as map
+		// key, and second half in _check.
+		static uint64_t contentKey(const Memory* _mem, uint32_t _seed, uint64_t& _check)
+		{
+			const uint64_t c1 = UINT64_C(0x87c37b91114253d5);
+			const uint64_t c2 = UINT64_C(0x4cf5ad432745937f);
+
+			const uint8_t* data = _mem->data;
+			const uint32_t size = _mem->size;
+			const uint32_t numBlocks = size/16;
+
+			uint64_t h1 = _seed;
+			uint64_t h2 = _seed;
+
+			for (uint32_t ii = 0; ii < numBlocks; ++ii)
+			{
+				uint64_t k1;
+				uint64_t k2;
+				memcpy(&k1, &data[ii*16],   8);
+				memcpy(&k2, &data[ii*16+8], 8);
+
+				k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+				h1 = rotl64(h1, 27); h1 += h2; h1 = h1*5 + 0x52dce729;
+
+				k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+				h2 = rotl64(h2, 31); h2 += h1; h2 = h2*5 + 0x38495ab5;
+			}
+
+			uint8_t tail[16] = {};
+			memcpy(tail, &data[numBlocks*16], size&15);
+
+			uint64_t k1;
+			uint64_t k2;
+			memcpy(&k1, &tail[0], 8);
+			memcpy(&k2, &tail[8], 8);
+
+			k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+			k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+
+			h1 ^= size;
+			h2 ^= size;
+			h1 += h2;
+			h2 += h1;
+			h1 = fmix64(h1);
+			h2 = fmix64(h2);
+			h1 += h2;
+			h2 += h1;
+
+			_check = h2;
+			return h1;
+		}
+
 		struct UniformRef
 		{
 			UniformType::Enum m_type;
@@ -3007,6 +4049,8 @@ namespace bgfx
 		struct TextureRef
 		{
 			int16_t m_refCount;
+			uint8_t m_decodeFormat;
+			bool m_pending;
 		};
 
 		struct FrameBufferRef
@@ -3024,6 +4068,13 @@ namespace bgfx
 		UniformRef m_uniformRef[BGFX_CONFIG_MAX_UNIFORMS];
 		ShaderRef m_shaderRef[BGFX_CONFIG_MAX_SHADERS];
 		ProgramRef m_programRef[BGFX_CONFIG_MAX_PROGRAMS];
+		ContentRef m_indexBufferRef[BGFX_CONFIG_MAX_INDEX_BUFFERS];
+		uint16_t m_indexBufferFlags[BGFX_CONFIG_MAX_INDEX_BUFFERS];
+		ContentRef m_vertexBufferRef[BGFX_CONFIG_MAX_VERTEX_BUFFERS];
+		ContentHashMap m_indexBufferHashMap;
+		ContentHashMap m_vertexBufferHashMap;
+		ContentHashMap m_shaderHashMap;
+		ContentHashMap m_programHashMap;
 		TextureRef m_textureRef[BGFX_CONFIG_MAX_TEXTURES];
 		FrameBufferRef m_frameBufferRef[BGFX_CONFIG_MAX_FRAME_BUFFERS];
 		VertexDeclRef m_declRef;
@@ -3041,6 +4092,17 @@ namespace bgfx
 
 		uint8_t m_clearColorDirty;
 
+		uint32_t m_uploadBudgetSize;
+		uint32_t m_uploadBudgetTime;
+		char m_capturePath[256];
+		uint8_t m_captureFormat;
+		bool m_captureDirty;
+		uint32_t m_captureNumDropped;
+		UploadQueue m_uploadQueue;
+		HandleListT<TextureHandle> m_uploadDone;
+		TextureDecoder m_textureDecoder;
+		TextureStreamer m_textureStreamer;
+
 		Resolution m_resolution;
 		int32_t  m_instBufferCount;
 		uint32_t m_frames;
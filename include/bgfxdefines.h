@@ -185,6 +185,10 @@
 #define BGFX_CLEAR_DEPTH_BIT             UINT8_C(0x02)
 #define BGFX_CLEAR_STENCIL_BIT           UINT8_C(0x04)
 
+///
+#define BGFX_BUFFER_NONE                 UINT16_C(0x0000)
+#define BGFX_BUFFER_INDEX32              UINT16_C(0x0001)
+
 ///
 #define BGFX_DEBUG_NONE                  UINT32_C(0x00000000)
 #define BGFX_DEBUG_WIREFRAME             UINT32_C(0x00000001)
@@ -217,6 +221,7 @@
 #define BGFX_TEXTURE_MIP_POINT           UINT32_C(0x00000400)
 #define BGFX_TEXTURE_MIP_SHIFT           10
 #define BGFX_TEXTURE_MIP_MASK            UINT32_C(0x00000400)
+#define BGFX_TEXTURE_RESIZE              UINT32_C(0x00000800)
 #define BGFX_TEXTURE_RT                  UINT32_C(0x00001000)
 #define BGFX_TEXTURE_RT_MSAA_X2          UINT32_C(0x00002000)
 #define BGFX_TEXTURE_RT_MSAA_X4          UINT32_C(0x00003000)
@@ -237,6 +242,9 @@
 #define BGFX_TEXTURE_COMPARE_SHIFT       16
 #define BGFX_TEXTURE_COMPARE_MASK        UINT32_C(0x000f0000)
 #define BGFX_TEXTURE_COMPUTE_WRITE       UINT32_C(0x00100000)
+#define BGFX_TEXTURE_ASYNC               UINT32_C(0x00200000)
+#define BGFX_TEXTURE_MIPS_SRGB           UINT32_C(0x00400000)
+#define BGFX_TEXTURE_STREAM              UINT32_C(0x00800000)
 #define BGFX_TEXTURE_RESERVED_SHIFT      24
 #define BGFX_TEXTURE_RESERVED_MASK       UINT32_C(0xff000000)
 
@@ -276,5 +284,6 @@
 #define BGFX_CAPS_COMPUTE                UINT64_C(0x0000000000000100)
 #define BGFX_CAPS_FRAGMENT_ORDERING      UINT64_C(0x0000000000000200)
 #define BGFX_CAPS_SWAP_CHAIN             UINT64_C(0x0000000000000400)
+#define BGFX_CAPS_INDEX32                UINT64_C(0x0000000000000800)
 
 #endif // BGFX_DEFINES_H_HEADER_GUARD
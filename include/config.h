@@ -230,6 +230,95 @@
 #	define BGFX_CONFIG_MAX_CONSTANT_BUFFER_SIZE (512<<10)
 #endif // BGFX_CONFIG_MAX_CONSTANT_BUFFER_SIZE
 
+#ifndef BGFX_CONFIG_FRAME_SCRATCH_SIZE
+#	define BGFX_CONFIG_FRAME_SCRATCH_SIZE (64<<10)
+#endif // BGFX_CONFIG_FRAME_SCRATCH_SIZE
+
+#ifndef BGFX_CONFIG_MAX_FRAME_SCRATCH_SIZE
+// Frame scratch grows to peak per-frame usage up to this size, larger
+// requests fall back to g_allocator.
+#	define BGFX_CONFIG_MAX_FRAME_SCRATCH_SIZE (32<<20)
+#endif // BGFX_CONFIG_MAX_FRAME_SCRATCH_SIZE
+
+#ifndef BGFX_CONFIG_UPLOAD_BUDGET_SIZE
+// Max bytes of BGFX_TEXTURE_ASYNC texture data created per frame.
+#	define BGFX_CONFIG_UPLOAD_BUDGET_SIZE (4<<20)
+#endif // BGFX_CONFIG_UPLOAD_BUDGET_SIZE
+
+#ifndef BGFX_CONFIG_UPLOAD_BUDGET_TIME
+// Max time in microseconds spent creating BGFX_TEXTURE_ASYNC textures per
+// frame.
+#	define BGFX_CONFIG_UPLOAD_BUDGET_TIME 2000
+#endif // BGFX_CONFIG_UPLOAD_BUDGET_TIME
+
+#ifndef BGFX_CONFIG_DEDUPLICATE_RESOURCES
+// When enabled, creating shader, program, or static index/vertex buffer
+// with content identical to existing one returns existing handle with
+// incremented reference count.
+#	define BGFX_CONFIG_DEDUPLICATE_RESOURCES 0
+#endif // BGFX_CONFIG_DEDUPLICATE_RESOURCES
+
+#ifndef BGFX_CONFIG_TEXTURE_STREAM_BUDGET
+// Default budget in bytes for storage of BGFX_TEXTURE_STREAM textures.
+#	define BGFX_CONFIG_TEXTURE_STREAM_BUDGET (256<<20)
+#endif // BGFX_CONFIG_TEXTURE_STREAM_BUDGET
+
+#ifndef BGFX_CONFIG_TEXTURE_STREAM_FRAME_SIZE
+// Max bytes of BGFX_TEXTURE_STREAM textures promoted per frame.
+#	define BGFX_CONFIG_TEXTURE_STREAM_FRAME_SIZE (4<<20)
+#endif // BGFX_CONFIG_TEXTURE_STREAM_FRAME_SIZE
+
+#ifndef BGFX_CONFIG_TEXTURE_STREAM_MIN_SIZE
+// BGFX_TEXTURE_STREAM textures are created starting at first mip not
+// larger than this size, and are never demoted below it.
+#	define BGFX_CONFIG_TEXTURE_STREAM_MIN_SIZE 64
+#endif // BGFX_CONFIG_TEXTURE_STREAM_MIN_SIZE
+
+#ifndef BGFX_CONFIG_IMAGE_THREADS
+// Max number of threads used by image processing (decoding compressed
+// images, generating mips). Images are split into bands of at least
+// BGFX_CONFIG_IMAGE_BAND_SIZE rows.
+#	define BGFX_CONFIG_IMAGE_THREADS 4
+#endif // BGFX_CONFIG_IMAGE_THREADS
+
+#ifndef BGFX_CONFIG_IMAGE_BAND_SIZE
+#	define BGFX_CONFIG_IMAGE_BAND_SIZE 256
+#endif // BGFX_CONFIG_IMAGE_BAND_SIZE
+
+#ifndef BGFX_CONFIG_VERTEX_THREADS
+// Max number of threads used by vertex functions. Vertex streams are split
+// into chunks of at least BGFX_CONFIG_VERTEX_CHUNK_SIZE vertices.
+#	define BGFX_CONFIG_VERTEX_THREADS 4
+#endif // BGFX_CONFIG_VERTEX_THREADS
+
+#ifndef BGFX_CONFIG_VERTEX_CHUNK_SIZE
+#	define BGFX_CONFIG_VERTEX_CHUNK_SIZE 16384
+#endif // BGFX_CONFIG_VERTEX_CHUNK_SIZE
+
+#ifndef BGFX_CONFIG_WORKER_THREADS
+// Number of worker threads shared by image and vertex processing, in
+// addition to calling thread. Must be at least 1.
+#	define BGFX_CONFIG_WORKER_THREADS (BGFX_CONFIG_IMAGE_THREADS > BGFX_CONFIG_VERTEX_THREADS \
+		? BGFX_CONFIG_IMAGE_THREADS-1 : BGFX_CONFIG_VERTEX_THREADS-1)
+#endif // BGFX_CONFIG_WORKER_THREADS
+
+#ifndef BGFX_CONFIG_MAX_VERTEX_CONVERTERS
+// Number of vertex declaration pairs vertexConvert keeps converters for.
+#	define BGFX_CONFIG_MAX_VERTEX_CONVERTERS 16
+#endif // BGFX_CONFIG_MAX_VERTEX_CONVERTERS
+
+#ifndef BGFX_CONFIG_CAPTURE_BUFFERS
+// Number of buffers screenshots and captured frames are copied to before
+// they are written on writer thread. Captured frames arriving while all
+// buffers wait to be written are dropped.
+#	define BGFX_CONFIG_CAPTURE_BUFFERS 4
+#endif // BGFX_CONFIG_CAPTURE_BUFFERS
+
+#ifndef BGFX_CONFIG_CAPTURE_FRAME_RATE
+// Frame rate written to Y4M capture header.
+#	define BGFX_CONFIG_CAPTURE_FRAME_RATE 60
+#endif // BGFX_CONFIG_CAPTURE_FRAME_RATE
+
 #ifndef BGFX_CONFIG_USE_TINYSTL
 #	define BGFX_CONFIG_USE_TINYSTL 1
 #endif // BGFX_CONFIG_USE_TINYSTL
@@ -72,6 +72,24 @@ namespace bgfx
 	///
 	void imageRgba8Downsample2x2(uint32_t _width, uint32_t _height, uint32_t _srcPitch, const void* _src, void* _dst);
 
+	///
+	bool imageCanGenerateMips(TextureFormat::Enum _format);
+
+	///
+	bool imageGenerateMips(uint16_t _width, uint16_t _height, uint16_t _depth, uint8_t _numSides, uint8_t _numMips, TextureFormat::Enum _format, bool _srgb, const void* _src, void* _dst);
+
+	///
+	bool imageResize(void* _dst, uint32_t _dstWidth, uint32_t _dstHeight, const void* _src, uint32_t _srcWidth, uint32_t _srcHeight, TextureFormat::Enum _format, uint32_t _srcPitch, ImageFilter::Enum _filter, bool _srgb);
+
+	///
+	bool imageEncodeFromBgra8(void* _dst, const void* _src, uint32_t _width, uint32_t _height, uint32_t _pitch, TextureFormat::Enum _format, ImageQuality::Enum _quality);
+
+	///
+	bool imageCanConvert(TextureFormat::Enum _dstFormat, TextureFormat::Enum _srcFormat);
+
+	///
+	bool imageConvert(void* _dst, TextureFormat::Enum _dstFormat, const void* _src, TextureFormat::Enum _srcFormat, uint32_t _width, uint32_t _height, uint32_t _srcPitch, bool _premultiply);
+
 	///
 	void imageSwizzleBgra8(uint32_t _width, uint32_t _height, uint32_t _srcPitch, const void* _src, void* _dst);
 
@@ -90,6 +108,9 @@ namespace bgfx
 	///
 	void imageDecodeToBgra8(uint8_t* _dst, const uint8_t* _src, uint32_t _width, uint32_t _height, uint32_t _srcPitch, uint8_t _type);
 
+	/// Scalar single-threaded reference implementation of imageDecodeToBgra8.
+	void imageDecodeToBgra8Ref(uint8_t* _dst, const uint8_t* _src, uint32_t _width, uint32_t _height, uint32_t _srcPitch, uint8_t _type);
+
 	///
 	bool imageGetRawData(const ImageContainer& _dds, uint8_t _side, uint8_t _index, const void* _data, uint32_t _size, ImageMip& _mip);
 
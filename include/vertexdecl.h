@@ -7,10 +7,24 @@
 #define BGFX_VERTEXDECL_H_HEADER_GUARD
 
 #include <bgfx.h>
+#include <bx/allocator.h>
 #include <bx/readerwriter.h>
 
+#define BGFX_CHUNK_MAGIC_MSH BX_MAKEFOURCC('M', 'S', 'H', 0x0)
+
 namespace bgfx
 {
+	///
+	typedef void (*ParallelRangeFn)(void* _userData, uint32_t _begin, uint32_t _end);
+
+	/// Calls _fn for up to _maxRanges ranges [_begin, _end) covering _num
+	/// items, of at least _minRange items each. Ranges run on worker threads
+	/// shared by image and vertex functions, and on calling thread.
+	void parallelRanges(ParallelRangeFn _fn, void* _userData, uint32_t _num, uint32_t _minRange, uint32_t _maxRanges);
+
+	/// Stops worker threads. They are started again on next use.
+	void parallelShutdown();
+
 	///
 	void initAttribTypeSizeTable(RendererType::Enum _type);
 
@@ -35,6 +49,95 @@ namespace bgfx
 	///
 	int32_t read(bx::ReaderI* _reader, bgfx::VertexDecl& _decl);
 
+	/// Converts vertex streams from one vertex declaration to another.
+	/// Conversion kernel for each attribute is selected once in init, and
+	/// convert runs them over batches of vertices.
+	struct VertexConverter
+	{
+		/// Conversion op for single destination attribute.
+		struct Op
+		{
+			enum Enum
+			{
+				Set,
+				Copy,
+				Convert,
+			};
+
+			uint16_t m_src;
+			uint16_t m_dest;
+			uint8_t m_op;
+			uint8_t m_size;
+			uint8_t m_srcType;
+			uint8_t m_srcNum;
+			uint8_t m_destType;
+			uint8_t m_destNum;
+			bool m_srcAsInt;
+			bool m_destAsInt;
+		};
+
+		/// Selects conversion ops from _srcDecl to _destDecl.
+		void init(const VertexDecl& _destDecl, const VertexDecl& _srcDecl);
+
+		/// Converts _num vertices. Vertex stream is split into chunks of
+		/// BGFX_CONFIG_VERTEX_CHUNK_SIZE vertices converted on up to
+		/// BGFX_CONFIG_VERTEX_THREADS threads.
+		void convert(void* _destData, const void* _srcData, uint32_t _num) const;
+
+		uint16_t m_destStride;
+		uint16_t m_srcStride;
+		uint8_t m_numOps;
+		bool m_memcpy;
+		Op m_op[Attrib::Count];
+	};
+
+	/// Weld vertices, temporary buffers are allocated from _allocator.
+	uint16_t weldVertices(uint16_t* _output, const VertexDecl& _decl, const void* _data, uint16_t _num, float _epsilon, bx::AllocatorI* _allocator);
+
+	/// Weld vertices with 32-bit vertex count, temporary buffers are
+	/// allocated from _allocator.
+	uint32_t weldVertices(uint32_t* _output, void* _dstData, const VertexDecl& _decl, const void* _data, uint32_t _num, float _epsilon, const Attrib::Enum* _attribs, uint8_t _numAttribs, bx::AllocatorI* _allocator);
+
+	/// Reorder triangles for vertex cache locality, temporary buffers are
+	/// allocated from _allocator.
+	void optimizeVertexCache(void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, uint32_t _numVertices, bx::AllocatorI* _allocator);
+
+	/// Reorder triangle clusters to reduce overdraw, temporary buffers are
+	/// allocated from _allocator.
+	void optimizeOverdraw(void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, float _threshold, bx::AllocatorI* _allocator);
+
+	/// Reorder vertices in order of first use, remap table is allocated
+	/// from _allocator.
+	uint32_t optimizeVertexFetch(void* _dstVertices, void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, uint32_t _numVertices, bx::AllocatorI* _allocator);
+
+	/// Optimize mesh, temporary buffers are allocated from _allocator.
+	MeshOptimizeStats optimizeMesh(void* _dstVertices, void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, uint32_t _numVertices, float _overdrawThreshold, bx::AllocatorI* _allocator);
+
+	/// Simplify mesh, temporary buffers are allocated from _allocator.
+	uint32_t simplifyMesh(void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, uint32_t _numVertices, uint32_t _targetIndices, float _maxError, const Attrib::Enum* _attribs, uint8_t _numAttribs, float* _error, bx::AllocatorI* _allocator);
+
+	/// Generate mesh LOD chain, temporary buffers are allocated from
+	/// _allocator.
+	uint8_t generateMeshLods(MeshLod* _lods, uint8_t _maxLods, void* _dst, uint32_t _maxIndices, const void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, uint32_t _numVertices, float _ratio, const Attrib::Enum* _attribs, uint8_t _numAttribs, bx::AllocatorI* _allocator);
+
+	/// Calculate tangent frames, temporary buffers are allocated from
+	/// _allocator.
+	void calcTangents(void* _vertices, uint32_t _numVertices, const VertexDecl& _decl, const void* _indices, uint32_t _numIndices, bool _index32, bx::AllocatorI* _allocator);
+
+	/// Build meshlets, temporary buffers are allocated from _allocator.
+	uint32_t buildMeshlets(Meshlet* _meshlets, void* _dst, const void* _indices, uint32_t _numIndices, bool _index32, const VertexDecl& _decl, const void* _vertices, uint32_t _numVertices, uint32_t _maxVertices, uint32_t _maxTriangles, bx::AllocatorI* _allocator);
+
+	/// Write indices of visible meshlets to _visible, and set _numIndices
+	/// to total number of their indices. Returns number of visible
+	/// meshlets.
+	uint32_t meshletsVisible(uint32_t* _visible, uint32_t& _numIndices, const Meshlet* _meshlets, uint32_t _numMeshlets, const float* _mtx, const float* _eye);
+
+	/// Copy indices of meshlets listed by meshletsVisible to _dst.
+	void meshletsCopy(void* _dst, const uint32_t* _visible, uint32_t _numVisible, const Meshlet* _meshlets, const void* _indices, bool _index32);
+
+	/// Cull meshlets, list of visible meshlets is allocated from _allocator.
+	uint32_t cullMeshlets(void* _dst, const Meshlet* _meshlets, uint32_t _numMeshlets, const void* _indices, bool _index32, const float* _mtx, const float* _eye, bx::AllocatorI* _allocator);
+
 } // namespace bgfx
 
 #endif // BGFX_VERTEXDECL_H_HEADER_GUARD
@@ -0,0 +1,976 @@
+package bgfx
+
+import (
+	"bytes"
+	"encoding/binary"
+	"io/ioutil"
+	"math"
+	"math/rand"
+	"os"
+	"reflect"
+	"runtime"
+	"strings"
+	"testing"
+	"unsafe"
+)
+
+type vertexAttrib struct {
+	attrib     Attrib
+	num        uint8
+	typ        AttribType
+	normalized bool
+	asint      bool
+}
+
+func newVertexDecl(attribs []vertexAttrib) VertexDecl {
+	var decl VertexDecl
+	decl.Begin()
+	for _, a := range attribs {
+		decl.Add(a.attrib, a.num, a.typ, a.normalized, a.asint)
+	}
+	decl.End()
+	return decl
+}
+
+// newVertices returns slice of num vertices, each stride bytes, and its
+// backing bytes.
+func newVertices(stride, num int) (interface{}, []byte) {
+	typ := reflect.ArrayOf(stride, reflect.TypeOf(byte(0)))
+	val := reflect.MakeSlice(reflect.SliceOf(typ), num, num)
+	data := unsafe.Slice((*byte)(unsafe.Pointer(val.Pointer())), stride*num)
+	return val.Interface(), data
+}
+
+// vertexConvertRef converts vertex at a time with VertexUnpack and
+// VertexPack. Attributes must not have same encoding in both decls.
+func vertexConvertRef(destDecl, srcDecl VertexDecl, destAttribs []vertexAttrib, dest, src interface{}, num int) {
+	for ii := 0; ii < num; ii++ {
+		for _, a := range destAttribs {
+			VertexPack(VertexUnpack(a.attrib, srcDecl, src, ii), true, a.attrib, destDecl, dest, ii)
+		}
+	}
+}
+
+func TestVertexConvert(t *testing.T) {
+	float := []vertexAttrib{
+		{AttribPosition, 3, AttribTypeFloat, false, false},
+		{AttribNormal, 3, AttribTypeFloat, false, false},
+		{AttribColor0, 4, AttribTypeFloat, false, false},
+		{AttribTexcoord0, 2, AttribTypeFloat, false, false},
+		{AttribTexcoord1, 4, AttribTypeFloat, false, false},
+	}
+	packed := []vertexAttrib{
+		{AttribPosition, 3, AttribTypeHalf, false, false},
+		{AttribNormal, 4, AttribTypeUint8, true, true},
+		{AttribColor0, 4, AttribTypeUint8, true, false},
+		{AttribTexcoord0, 2, AttribTypeInt16, true, true},
+		{AttribTexcoord1, 3, AttribTypeInt16, true, false},
+		{AttribTangent, 4, AttribTypeHalf, false, false},
+	}
+
+	// More vertices than BGFX_CONFIG_VERTEX_CHUNK_SIZE exercise threads.
+	const num = 40000
+	specials := []float32{0, float32(math.Copysign(0, -1)), 1, -1, 65504, 65520, 1e-5, -6e-8, 1e10,
+		float32(math.Inf(1)), float32(math.NaN()), 0.49999997, 1.0 / 255, 2.0 / 3}
+
+	rng := rand.New(rand.NewSource(1))
+	floatDecl := newVertexDecl(float)
+	src, srcData := newVertices(floatDecl.Stride(), num)
+	for ii := 0; ii < len(srcData); ii += 4 {
+		var value float32
+		switch rng.Intn(4) {
+		case 0:
+			value = specials[rng.Intn(len(specials))]
+		case 1:
+			value = float32(math.Ldexp(rng.Float64()-0.5, rng.Intn(40)-20))
+		default:
+			value = rng.Float32()*3 - 1.5
+		}
+		binary.LittleEndian.PutUint32(srcData[ii:], math.Float32bits(value))
+	}
+
+	packedDecl := newVertexDecl(packed)
+	ref, refData := newVertices(packedDecl.Stride(), num)
+	opt, optData := newVertices(packedDecl.Stride(), num)
+	vertexConvertRef(packedDecl, floatDecl, packed, ref, src, num)
+	VertexConvert(packedDecl, floatDecl, opt, src)
+	if !bytes.Equal(refData, optData) {
+		t.Errorf("float to packed vertices don't match reference")
+	}
+
+	// Random bytes cover whole range of packed values.
+	ref, refData = newVertices(floatDecl.Stride(), num)
+	opt, optData = newVertices(floatDecl.Stride(), num)
+	packedSrc, packedSrcData := newVertices(packedDecl.Stride(), num)
+	rng.Read(packedSrcData)
+	vertexConvertRef(floatDecl, packedDecl, float, ref, packedSrc, num)
+	VertexConvert(floatDecl, packedDecl, opt, packedSrc)
+	if !bytes.Equal(refData, optData) {
+		t.Errorf("packed to float vertices don't match reference")
+	}
+
+	// Same declaration is copied.
+	same, sameData := newVertices(packedDecl.Stride(), num)
+	VertexConvert(packedDecl, packedDecl, same, packedSrc)
+	if !bytes.Equal(sameData, packedSrcData) {
+		t.Errorf("vertices with same declaration aren't copied")
+	}
+}
+
+func TestVertexPackArray(t *testing.T) {
+	packed := []vertexAttrib{
+		{AttribPosition, 3, AttribTypeHalf, false, false},
+		{AttribNormal, 4, AttribTypeUint8, true, true},
+		{AttribColor0, 4, AttribTypeUint8, true, false},
+		{AttribTexcoord0, 2, AttribTypeInt16, true, true},
+		{AttribTexcoord1, 3, AttribTypeInt16, true, false},
+		{AttribTexcoord2, 3, AttribTypeFloat, false, false},
+	}
+	decl := newVertexDecl(packed)
+
+	const num = 40000
+	const index = 3
+	rng := rand.New(rand.NewSource(1))
+	ref, refData := newVertices(decl.Stride(), num+index)
+	opt, optData := newVertices(decl.Stride(), num+index)
+	for _, normalized := range []bool{true, false} {
+		for ii, a := range packed {
+			// Input component count different from attribute's.
+			inputNum := 1 + ii%4
+			input := make([]float32, num*inputNum)
+			for jj := range input {
+				if normalized {
+					input[jj] = rng.Float32()*2 - 1
+				} else {
+					input[jj] = float32(rng.Intn(200))
+				}
+			}
+			for jj := 0; jj < num; jj++ {
+				var vec [4]float32
+				copy(vec[:], input[jj*inputNum:(jj+1)*inputNum])
+				VertexPack(vec, normalized, a.attrib, decl, ref, index+jj)
+			}
+			VertexPackArray(input, inputNum, normalized, a.attrib, decl, opt, index)
+		}
+		if !bytes.Equal(refData, optData) {
+			t.Errorf("packed arrays (normalized %v) don't match VertexPack", normalized)
+		}
+	}
+
+	for _, outputNum := range []int{2, 4, 5} {
+		for _, a := range append(packed, vertexAttrib{attrib: AttribColor1}) {
+			output := make([]float32, num*outputNum)
+			VertexUnpackArray(output, outputNum, a.attrib, decl, opt, index)
+			for jj := 0; jj < num; jj++ {
+				var vec [5]float32
+				unpacked := VertexUnpack(a.attrib, decl, opt, index+jj)
+				copy(vec[:], unpacked[:])
+				if !reflect.DeepEqual(output[jj*outputNum:(jj+1)*outputNum], vec[:outputNum]) {
+					t.Fatalf("unpacked array attrib %d vertex %d: %v, VertexUnpack: %v",
+						a.attrib, jj, output[jj*outputNum:(jj+1)*outputNum], vec[:outputNum])
+				}
+			}
+		}
+	}
+}
+
+func BenchmarkVertexConvert(b *testing.B) {
+	float := newVertexDecl([]vertexAttrib{
+		{AttribPosition, 3, AttribTypeFloat, false, false},
+		{AttribNormal, 3, AttribTypeFloat, false, false},
+		{AttribColor0, 4, AttribTypeFloat, false, false},
+		{AttribTexcoord0, 2, AttribTypeFloat, false, false},
+	})
+	packed := newVertexDecl([]vertexAttrib{
+		{AttribPosition, 4, AttribTypeHalf, false, false},
+		{AttribNormal, 4, AttribTypeUint8, true, true},
+		{AttribColor0, 4, AttribTypeUint8, true, false},
+		{AttribTexcoord0, 2, AttribTypeInt16, true, true},
+	})
+
+	const num = 1 << 20
+	src, srcData := newVertices(float.Stride(), num)
+	rng := rand.New(rand.NewSource(1))
+	for ii := 0; ii < len(srcData); ii += 4 {
+		binary.LittleEndian.PutUint32(srcData[ii:], math.Float32bits(rng.Float32()*2-1))
+	}
+	dest, _ := newVertices(packed.Stride(), num)
+
+	b.SetBytes(int64(len(srcData)))
+	for ii := 0; ii < b.N; ii++ {
+		VertexConvert(packed, float, dest, src)
+	}
+}
+
+func TestQuantizeVertices(t *testing.T) {
+	floatDecl := newVertexDecl([]vertexAttrib{
+		{AttribPosition, 3, AttribTypeFloat, false, false},
+		{AttribNormal, 3, AttribTypeFloat, false, false},
+		{AttribColor0, 4, AttribTypeFloat, false, false},
+		{AttribTexcoord0, 2, AttribTypeFloat, false, false},
+	})
+	quantDecl := QuantizeVertexDecl(floatDecl)
+	if quantDecl.Stride() != 20 {
+		t.Fatalf("quantized stride %d, expected 20", quantDecl.Stride())
+	}
+
+	const num = 40000
+	rng := rand.New(rand.NewSource(1))
+	src, srcData := newVertices(floatDecl.Stride(), num)
+	vertices := make([][12]float32, num)
+	for ii := range vertices {
+		v := &vertices[ii]
+		v[0], v[1], v[2] = rng.Float32()*20-5, rng.Float32()*2+100, rng.Float32()*0.5
+		nx, ny, nz := rng.NormFloat64(), rng.NormFloat64(), rng.NormFloat64()
+		length := math.Sqrt(nx*nx + ny*ny + nz*nz)
+		v[3], v[4], v[5] = float32(nx/length), float32(ny/length), float32(nz/length)
+		for jj := 6; jj < 10; jj++ {
+			v[jj] = float32(rng.Intn(256)) / 255
+		}
+		v[10], v[11] = rng.Float32()*2-1, rng.Float32()
+		for jj, value := range v {
+			binary.LittleEndian.PutUint32(srcData[ii*floatDecl.Stride()+jj*4:], math.Float32bits(value))
+		}
+	}
+
+	dest, _ := newVertices(quantDecl.Stride(), num)
+	q := QuantizeVertices(quantDecl, floatDecl, dest, src)
+
+	near := func(a, b, epsilon float32) bool {
+		return math.Abs(float64(a-b)) <= float64(epsilon)
+	}
+	for ii, v := range vertices {
+		pos := VertexUnpack(AttribPosition, quantDecl, dest, ii)
+		for jj := 0; jj < 3; jj++ {
+			if p := pos[jj]*q.Scale[jj] + q.Bias[jj]; !near(p, v[jj], q.Scale[jj]/32767+1e-4) {
+				t.Fatalf("vertex %d: position %v, expected %v", ii, p, v[jj])
+			}
+		}
+
+		// Octahedral decode.
+		oct := VertexUnpack(AttribNormal, quantDecl, dest, ii)
+		x, y := oct[0], oct[1]
+		z := 1 - float32(math.Abs(float64(x))) - float32(math.Abs(float64(y)))
+		if z < 0 {
+			x, y = (1-float32(math.Abs(float64(oct[1]))))*float32(math.Copysign(1, float64(oct[0]))),
+				(1-float32(math.Abs(float64(oct[0]))))*float32(math.Copysign(1, float64(oct[1])))
+		}
+		length := float32(math.Sqrt(float64(x*x + y*y + z*z)))
+		if !near(x/length, v[3], 1e-3) || !near(y/length, v[4], 1e-3) || !near(z/length, v[5], 1e-3) {
+			t.Fatalf("vertex %d: normal %v %v %v, expected %v", ii, x/length, y/length, z/length, v[3:6])
+		}
+
+		color := VertexUnpack(AttribColor0, quantDecl, dest, ii)
+		for jj := 0; jj < 4; jj++ {
+			if color[jj] != v[6+jj] {
+				t.Fatalf("vertex %d: color %v, expected %v", ii, color, v[6:10])
+			}
+		}
+
+		uv := VertexUnpack(AttribTexcoord0, quantDecl, dest, ii)
+		if !near(uv[0], v[10], 1e-3) || !near(uv[1], v[11], 1e-3) {
+			t.Fatalf("vertex %d: texcoord %v, expected %v", ii, uv[:2], v[10:12])
+		}
+	}
+}
+
+// weldVerticesRef welds each of float vertices to first unique vertex
+// within epsilon.
+func weldVerticesRef(vertices [][]float32, epsilon float32, attribs bool) ([]uint32, int) {
+	remap := make([]uint32, len(vertices))
+	var unique [][]float32
+	for ii, vertex := range vertices {
+		remap[ii] = uint32(len(unique))
+	search:
+		for index, test := range unique {
+			dx, dy, dz := vertex[0]-test[0], vertex[1]-test[1], vertex[2]-test[2]
+			if !(dx*dx+dy*dy+dz*dz < epsilon*epsilon) {
+				continue
+			}
+			for jj := 3; attribs && jj < len(vertex); jj++ {
+				if !(float32(math.Abs(float64(vertex[jj]-test[jj]))) < epsilon) {
+					continue search
+				}
+			}
+			remap[ii] = uint32(index)
+			break
+		}
+		if remap[ii] == uint32(len(unique)) {
+			unique = append(unique, vertex)
+		}
+	}
+	return remap, len(unique)
+}
+
+func TestWeldVertices(t *testing.T) {
+	decl := newVertexDecl([]vertexAttrib{
+		{AttribPosition, 3, AttribTypeFloat, false, false},
+		{AttribTexcoord0, 2, AttribTypeFloat, false, false},
+	})
+	stride := decl.Stride()
+
+	// Positions jittered around coarse lattice weld across cell borders,
+	// and chains of close vertices aren't welded transitively.
+	const epsilon = 0.01
+	rng := rand.New(rand.NewSource(1))
+	for _, num := range []int{1, 1000, 40000} {
+		src, srcData := newVertices(stride, num)
+		vertices := make([][]float32, num)
+		for ii := range vertices {
+			vertex := make([]float32, 5)
+			for jj := 0; jj < 3; jj++ {
+				vertex[jj] = float32(rng.Intn(8))*0.1 + float32(rng.Intn(3))*0.007
+			}
+			vertex[3] = float32(rng.Intn(2)) * 0.5
+			vertex[4] = float32(rng.NormFloat64() * 0.003)
+			for jj, value := range vertex {
+				binary.LittleEndian.PutUint32(srcData[ii*stride+jj*4:], math.Float32bits(value))
+			}
+			vertices[ii] = vertex
+		}
+
+		for _, attribs := range [][]Attrib{nil, {AttribTexcoord0}} {
+			refRemap, refNum := weldVerticesRef(vertices, epsilon, attribs != nil)
+			dest, destData := newVertices(stride, num)
+			remap, unique := WeldVertices(dest, src, decl, epsilon, attribs...)
+			if unique != refNum || !reflect.DeepEqual(remap, refRemap) {
+				t.Errorf("%d vertices, attribs %v: welded to %d vertices, reference %d", num, attribs, unique, refNum)
+				continue
+			}
+
+			// Unique vertices are compacted in order of first occurrence.
+			next := uint32(0)
+			for ii, index := range remap {
+				if index == next {
+					if !bytes.Equal(destData[int(index)*stride:][:stride], srcData[ii*stride:][:stride]) {
+						t.Errorf("%d vertices: compacted vertex %d doesn't match", num, index)
+					}
+					next++
+				}
+			}
+		}
+	}
+}
+
+func TestOptimizeMesh(t *testing.T) {
+	decl := newVertexDecl([]vertexAttrib{
+		{AttribPosition, 3, AttribTypeFloat, false, false},
+	})
+	stride := decl.Stride()
+
+	// Grid of quads with shuffled triangles, and unused last vertex.
+	const size = 100
+	const numVertices = (size+1)*(size+1) + 1
+	src, srcData := newVertices(stride, numVertices)
+	for ii := 0; ii < numVertices; ii++ {
+		x, y := float32(ii%(size+1)), float32(ii/(size+1))
+		binary.LittleEndian.PutUint32(srcData[ii*stride:], math.Float32bits(x))
+		binary.LittleEndian.PutUint32(srcData[ii*stride+4:], math.Float32bits(y))
+		binary.LittleEndian.PutUint32(srcData[ii*stride+8:], math.Float32bits(x*y*0.01))
+	}
+
+	var triangles [][3]uint16
+	for y := 0; y < size; y++ {
+		for x := 0; x < size; x++ {
+			v := uint16(y*(size+1) + x)
+			triangles = append(triangles, [3]uint16{v, v + 1, v + size + 1}, [3]uint16{v + 1, v + size + 2, v + size + 1})
+		}
+	}
+	rand.New(rand.NewSource(1)).Shuffle(len(triangles), func(ii, jj int) {
+		triangles[ii], triangles[jj] = triangles[jj], triangles[ii]
+	})
+
+	indices := make([]uint16, 0, len(triangles)*3)
+	for _, tri := range triangles {
+		indices = append(indices, tri[:]...)
+	}
+
+	// Triangles are compared by vertex data, starting at lowest vertex to
+	// keep winding.
+	triangleSet := func(indices []uint16, data []byte) map[string]int {
+		set := make(map[string]int)
+		for ii := 0; ii < len(indices); ii += 3 {
+			first := 0
+			for jj := 1; jj < 3; jj++ {
+				if bytes.Compare(data[int(indices[ii+jj])*stride:][:stride], data[int(indices[ii+first])*stride:][:stride]) < 0 {
+					first = jj
+				}
+			}
+			var key []byte
+			for jj := 0; jj < 3; jj++ {
+				key = append(key, data[int(indices[ii+(first+jj)%3])*stride:][:stride]...)
+			}
+			set[string(key)]++
+		}
+		return set
+	}
+	ref := triangleSet(indices, srcData)
+
+	dest, destData := newVertices(stride, numVertices)
+	stats := OptimizeMesh(dest, src, decl, indices, 1.05)
+
+	if stats.NumVertices != numVertices-1 {
+		t.Errorf("optimized mesh has %d vertices, expected %d", stats.NumVertices, numVertices-1)
+	}
+	if acmr := VertexCacheMissRatio(indices, 16); acmr != stats.ACMRAfter {
+		t.Errorf("ACMR after optimization %f, reported %f", acmr, stats.ACMRAfter)
+	}
+	if stats.ACMRBefore < 2 || stats.ACMRAfter > 0.8 {
+		t.Errorf("ACMR %f before, %f after optimization", stats.ACMRBefore, stats.ACMRAfter)
+	}
+	if !reflect.DeepEqual(ref, triangleSet(indices, destData)) {
+		t.Errorf("optimized mesh triangles don't match")
+	}
+
+	next := uint16(0)
+	for _, index := range indices {
+		if index > next {
+			t.Fatalf("vertex %d used before vertex %d", index, next)
+		}
+		if index == next {
+			next++
+		}
+	}
+}
+
+func TestSimplifyMesh(t *testing.T) {
+	decl := newVertexDecl([]vertexAttrib{
+		{AttribPosition, 3, AttribTypeFloat, false, false},
+		{AttribTexcoord0, 2, AttribTypeFloat, false, false},
+	})
+	stride := decl.Stride()
+
+	// Grid with gentle bump, and texture seam splitting its vertices at
+	// middle column.
+	const size = 64
+	var positions [][3]float32
+	var texcoords [][2]float32
+	grid := make([][2]int, (size+1)*(size+1))
+	for y := 0; y <= size; y++ {
+		for x := 0; x <= size; x++ {
+			fx, fy := float32(x)/size, float32(y)/size
+			z := 0.1 * float32(math.Sin(float64(fx)*math.Pi)*math.Sin(float64(fy)*math.Pi))
+			grid[y*(size+1)+x] = [2]int{len(positions), len(positions)}
+			positions = append(positions, [3]float32{fx, fy, z})
+			texcoords = append(texcoords, [2]float32{fx, fy})
+			if x == size/2 {
+				grid[y*(size+1)+x][1] = len(positions)
+				positions = append(positions, [3]float32{fx, fy, z})
+				texcoords = append(texcoords, [2]float32{fx + 1, fy})
+			}
+		}
+	}
+
+	src, srcData := newVertices(stride, len(positions))
+	for ii := range positions {
+		values := []float32{positions[ii][0], positions[ii][1], positions[ii][2], texcoords[ii][0], texcoords[ii][1]}
+		for jj, value := range values {
+			binary.LittleEndian.PutUint32(srcData[ii*stride+jj*4:], math.Float32bits(value))
+		}
+	}
+
+	var indices []uint16
+	for y := 0; y < size; y++ {
+		for x := 0; x < size; x++ {
+			side := 0
+			if x >= size/2 {
+				side = 1
+			}
+			v := func(dx, dy int) uint16 { return uint16(grid[(y+dy)*(size+1)+x+dx][side]) }
+			indices = append(indices, v(0, 0), v(1, 0), v(0, 1), v(1, 0), v(1, 1), v(0, 1))
+		}
+	}
+
+	const target = 600
+	simplified, simplifiedError := SimplifyMesh(indices, decl, src, target, 1, AttribTexcoord0)
+	if len(simplified) > target || len(simplified) == 0 {
+		t.Fatalf("simplified to %d indices, target %d", len(simplified), target)
+	}
+	if simplifiedError <= 0 || simplifiedError > 0.02 {
+		t.Errorf("simplification error %f", simplifiedError)
+	}
+
+	// Triangles keep facing up, and don't cross texture seam.
+	for ii := 0; ii < len(simplified); ii += 3 {
+		var p [3][3]float32
+		sides := 0
+		for jj := 0; jj < 3; jj++ {
+			index := simplified[ii+jj]
+			p[jj] = positions[index]
+			if texcoords[index][0] > positions[index][0] || positions[index][0] > 0.5 {
+				sides |= 2
+			} else if positions[index][0] < 0.5 {
+				sides |= 1
+			}
+		}
+		nz := (p[1][0]-p[0][0])*(p[2][1]-p[0][1]) - (p[1][1]-p[0][1])*(p[2][0]-p[0][0])
+		if nz <= 0 {
+			t.Fatalf("triangle %d flipped %v", ii/3, p)
+		}
+		if sides == 3 {
+			t.Fatalf("triangle %d crosses texture seam", ii/3)
+		}
+	}
+
+	// Corners are kept.
+	for _, corner := range []int{0, size, size * (size + 1), (size+1)*(size+1) - 1} {
+		found := false
+		for _, index := range simplified {
+			found = found || int(index) == grid[corner][0] || int(index) == grid[corner][1]
+		}
+		if !found {
+			t.Errorf("corner vertex %d removed", corner)
+		}
+	}
+
+	flat, flatError := SimplifyMesh(indices, decl, src, 0, 0.001)
+	if flatError > 0.001 || len(flat) <= len(simplified) {
+		t.Errorf("simplified to %d indices with error %f, limit 0.001", len(flat), flatError)
+	}
+
+	lodIndices, lods := GenerateMeshLods(indices, decl, src, 8, 0.5, AttribTexcoord0)
+	if len(lods) < 4 || lods[0].NumIndices != len(indices) || !reflect.DeepEqual(lodIndices[:len(indices)], indices) {
+		t.Fatalf("%d LODs generated", len(lods))
+	}
+	for ii := 1; ii < len(lods); ii++ {
+		if lods[ii].StartIndex != lods[ii-1].StartIndex+lods[ii-1].NumIndices ||
+			lods[ii].NumIndices > lods[ii-1].NumIndices/2 ||
+			lods[ii].Error < lods[ii-1].Error {
+			t.Errorf("LOD %d: %+v, previous %+v", ii, lods[ii], lods[ii-1])
+		}
+	}
+
+	if lod := SelectMeshLod(lods, 1e6, 1); lod != 0 {
+		t.Errorf("close mesh selects LOD %d", lod)
+	}
+	if lod := SelectMeshLod(lods, 1, 1); lod != len(lods)-1 {
+		t.Errorf("distant mesh selects LOD %d", lod)
+	}
+	for ii := 1; ii < len(lods); ii++ {
+		if lod := SelectMeshLod(lods, 1/lods[ii].Error, 1); lod < ii || lods[lod].Error != lods[ii].Error {
+			t.Errorf("LOD %d error on screen selects LOD %d", ii, lod)
+		}
+	}
+}
+
+func TestMeshlets(t *testing.T) {
+	decl := newVertexDecl([]vertexAttrib{
+		{AttribPosition, 3, AttribTypeFloat, false, false},
+	})
+	stride := decl.Stride()
+
+	// Unit UV sphere.
+	const rings, segments = 64, 96
+	var positions [][3]float32
+	for ii := 0; ii <= rings; ii++ {
+		theta := math.Pi * float64(ii) / rings
+		for jj := 0; jj <= segments; jj++ {
+			phi := 2 * math.Pi * float64(jj) / segments
+			positions = append(positions, [3]float32{
+				float32(math.Sin(theta) * math.Cos(phi)),
+				float32(math.Cos(theta)),
+				float32(math.Sin(theta) * math.Sin(phi)),
+			})
+		}
+	}
+	src, srcData := newVertices(stride, len(positions))
+	for ii, pos := range positions {
+		for jj, value := range pos {
+			binary.LittleEndian.PutUint32(srcData[ii*stride+jj*4:], math.Float32bits(value))
+		}
+	}
+
+	var indices []uint16
+	for ii := 0; ii < rings; ii++ {
+		for jj := 0; jj < segments; jj++ {
+			v := uint16(ii*(segments+1) + jj)
+			indices = append(indices, v, v+segments+1, v+1, v+1, v+segments+1, v+segments+2)
+		}
+	}
+	optimized, optimizedData := newVertices(stride, len(positions))
+	OptimizeMesh(optimized, src, decl, indices, 1.05)
+	src = optimized
+	for ii := range positions {
+		for jj := range positions[ii] {
+			positions[ii][jj] = math.Float32frombits(binary.LittleEndian.Uint32(optimizedData[ii*stride+jj*4:]))
+		}
+	}
+
+	normal := func(tri []uint16) [3]float64 {
+		var p [3][3]float64
+		for ii := range p {
+			for jj := range p[ii] {
+				p[ii][jj] = float64(positions[tri[ii]][jj])
+			}
+		}
+		ba := [3]float64{p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2]}
+		ca := [3]float64{p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2]}
+		return [3]float64{ba[1]*ca[2] - ba[2]*ca[1], ba[2]*ca[0] - ba[0]*ca[2], ba[0]*ca[1] - ba[1]*ca[0]}
+	}
+
+	meshlets, indices := BuildMeshlets(indices, decl, src, 64, 124)
+	next := uint32(0)
+	for ii, meshlet := range meshlets {
+		if meshlet.StartIndex != next || meshlet.NumIndices == 0 || meshlet.NumIndices > 124*3 || meshlet.Radius > 0.5 {
+			t.Fatalf("meshlet %d: range %d, %d, radius %f", ii, meshlet.StartIndex, meshlet.NumIndices, meshlet.Radius)
+		}
+		next += meshlet.NumIndices
+
+		tris := indices[meshlet.StartIndex:][:meshlet.NumIndices]
+		unique := make(map[uint16]bool)
+		for _, index := range tris {
+			unique[index] = true
+			var distSq float32
+			for jj := 0; jj < 3; jj++ {
+				d := positions[index][jj] - meshlet.Center[jj]
+				distSq += d * d
+			}
+			if distSq > meshlet.Radius*meshlet.Radius*1.0001 {
+				t.Fatalf("meshlet %d: vertex outside bounding sphere", ii)
+			}
+		}
+		if len(unique) > 64 {
+			t.Fatalf("meshlet %d: %d vertices", ii, len(unique))
+		}
+
+		// Triangle normals are inside normal cone.
+		cosAngle := math.Sqrt(1 - float64(meshlet.ConeCutoff*meshlet.ConeCutoff))
+		for jj := 0; meshlet.ConeCutoff < 1 && jj < len(tris); jj += 3 {
+			n := normal(tris[jj:])
+			length := math.Sqrt(n[0]*n[0] + n[1]*n[1] + n[2]*n[2])
+			dot := n[0]*float64(meshlet.ConeAxis[0]) + n[1]*float64(meshlet.ConeAxis[1]) + n[2]*float64(meshlet.ConeAxis[2])
+			if length > 1e-9 && dot/length < cosAngle-1e-4 {
+				t.Fatalf("meshlet %d: triangle normal outside normal cone", ii)
+			}
+		}
+	}
+	if int(next) != len(indices) || len(meshlets) > len(indices)/3/40 {
+		t.Fatalf("%d meshlets cover %d of %d indices", len(meshlets), next, len(indices))
+	}
+
+	// Eye at -5 on z, looking towards +z, with 60 degree field of view.
+	viewProj := func(x float32) [16]float32 {
+		const near, far = 0.1, 100
+		h := float32(1 / math.Tan(math.Pi/6))
+		return [16]float32{
+			h, 0, 0, 0,
+			0, h, 0, 0,
+			0, 0, far / (far - near), 1,
+			x * h, 0, 5*far/(far-near) - near*far/(far-near), 5,
+		}
+	}
+	eye := [3]float32{0, 0, -5}
+
+	if visible := CullMeshlets(meshlets, indices, viewProj(0), nil); len(visible) != len(indices) {
+		t.Errorf("%d of %d indices inside frustum", len(visible), len(indices))
+	}
+	if visible := CullMeshlets(meshlets, indices, viewProj(100), nil); len(visible) != 0 {
+		t.Errorf("%d indices outside frustum aren't culled", len(visible))
+	}
+
+	visible := CullMeshlets(meshlets, indices, viewProj(0), &eye)
+	if len(visible) == 0 || len(visible) > len(indices)*17/20 {
+		t.Errorf("%d of %d indices not backface culled", len(visible), len(indices))
+	}
+	front := make(map[[3]uint16]bool)
+	for ii := 0; ii < len(visible); ii += 3 {
+		front[[3]uint16{visible[ii], visible[ii+1], visible[ii+2]}] = true
+	}
+	for ii := 0; ii < len(indices); ii += 3 {
+		n := normal(indices[ii:])
+		p := positions[indices[ii]]
+		toEye := [3]float64{float64(eye[0] - p[0]), float64(eye[1] - p[1]), float64(eye[2] - p[2])}
+		if n[0]*toEye[0]+n[1]*toEye[1]+n[2]*toEye[2] > 0 && !front[[3]uint16{indices[ii], indices[ii+1], indices[ii+2]}] {
+			t.Fatalf("front facing triangle %d culled", ii/3)
+		}
+	}
+}
+
+func TestMeshContainer(t *testing.T) {
+	decl := newVertexDecl([]vertexAttrib{
+		{AttribPosition, 3, AttribTypeFloat, false, false},
+		{AttribColor0, 4, AttribTypeUint8, true, false},
+	})
+	stride := decl.Stride()
+
+	// Two quads, second one translated and scaled.
+	positions := [][3]float32{
+		{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0},
+		{10, 0, 2}, {12, 0, 2}, {12, 2, 2}, {10, 2, 2},
+	}
+	_, vertices := newVertices(stride, len(positions))
+	for ii, pos := range positions {
+		for jj, value := range pos {
+			binary.LittleEndian.PutUint32(vertices[ii*stride+jj*4:], math.Float32bits(value))
+		}
+		vertices[ii*stride+12] = uint8(ii)
+	}
+	indices := []uint16{0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7}
+
+	mesh := MeshData{
+		Decl:     decl,
+		Vertices: vertices,
+		Indices:  indices,
+		Groups:   []MeshGroup{{StartIndex: 0, NumIndices: 6}, {StartIndex: 6, NumIndices: 6}},
+		Lods:     []MeshLod{{0, 12, 0}, {0, 6, 0.5}},
+		Meshlets: []Meshlet{{StartIndex: 6, NumIndices: 6, Radius: 1, ConeCutoff: 1}},
+	}
+	data := WriteMesh(mesh)
+
+	parsed, ok := ParseMesh(data)
+	switch {
+	case !ok:
+		t.Fatalf("can't parse written mesh")
+	case parsed.Decl.Stride() != stride:
+		t.Errorf("stride %d, expected %d", parsed.Decl.Stride(), stride)
+	case !bytes.Equal(parsed.Vertices, vertices):
+		t.Errorf("vertices don't match")
+	case !reflect.DeepEqual(parsed.Indices, indices) || parsed.Indices32 != nil:
+		t.Errorf("indices %v, expected %v", parsed.Indices, indices)
+	case !reflect.DeepEqual(parsed.Lods, mesh.Lods):
+		t.Errorf("lods %v, expected %v", parsed.Lods, mesh.Lods)
+	case !reflect.DeepEqual(parsed.Meshlets, mesh.Meshlets):
+		t.Errorf("meshlets %v, expected %v", parsed.Meshlets, mesh.Meshlets)
+	}
+
+	groups := []MeshGroup{
+		{0, 6, [3]float32{0.5, 0.5, 0}, float32(math.Sqrt(0.5)), [3]float32{0, 0, 0}, [3]float32{1, 1, 0}},
+		{6, 6, [3]float32{11, 1, 2}, float32(math.Sqrt(2)), [3]float32{10, 0, 2}, [3]float32{12, 2, 2}},
+	}
+	if !reflect.DeepEqual(parsed.Groups, groups) {
+		t.Errorf("groups %v, expected %v", parsed.Groups, groups)
+	}
+
+	// Mesh without groups gets single group of all indices.
+	indices32 := make([]uint32, len(indices))
+	for ii, index := range indices {
+		indices32[ii] = uint32(index)
+	}
+	parsed, ok = ParseMesh(WriteMesh(MeshData{Decl: decl, Vertices: vertices, Indices32: indices32}))
+	switch {
+	case !ok:
+		t.Fatalf("can't parse written mesh with 32-bit indices")
+	case !reflect.DeepEqual(parsed.Indices32, indices32) || parsed.Indices != nil:
+		t.Errorf("indices %v, expected %v", parsed.Indices32, indices32)
+	case len(parsed.Groups) != 1 || parsed.Groups[0].NumIndices != 12 || parsed.Groups[0].Max != [3]float32{12, 2, 2}:
+		t.Errorf("groups %v, expected single group of all indices", parsed.Groups)
+	case len(parsed.Lods) != 0 || len(parsed.Meshlets) != 0:
+		t.Errorf("unexpected lods %v and meshlets %v", parsed.Lods, parsed.Meshlets)
+	}
+
+	if _, ok := ParseMesh(data[:len(data)-1]); ok {
+		t.Errorf("truncated container is parsed")
+	}
+	corrupt := append([]byte(nil), data...)
+	corrupt[4]++
+	if _, ok := ParseMesh(corrupt); ok {
+		t.Errorf("container with wrong vertex count is parsed")
+	}
+	corrupt[0]++
+	if _, ok := ParseMesh(corrupt); ok {
+		t.Errorf("container with wrong magic is parsed")
+	}
+}
+
+// fileMapped reports whether path is mapped into process address space.
+func fileMapped(t *testing.T, path string) bool {
+	maps, err := ioutil.ReadFile("/proc/self/maps")
+	if err != nil {
+		t.Fatal(err)
+	}
+	return strings.Contains(string(maps), path)
+}
+
+func TestLoadMesh(t *testing.T) {
+	if runtime.GOOS != "linux" || os.Getenv("DISPLAY") == "" {
+		t.Skip("needs display and /proc/self/maps")
+	}
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+
+	decl := newVertexDecl([]vertexAttrib{
+		{AttribPosition, 3, AttribTypeFloat, false, false},
+	})
+	_, vertices := newVertices(decl.Stride(), 4)
+	indices := []uint16{0, 1, 2, 0, 2, 3}
+
+	file, err := ioutil.TempFile("", "bgfx-mesh")
+	if err != nil {
+		t.Fatal(err)
+	}
+	path := file.Name()
+	defer os.Remove(path)
+	_, err = file.Write(WriteMesh(MeshData{Decl: decl, Vertices: vertices, Indices: indices}))
+	file.Close()
+	if err != nil {
+		t.Fatal(err)
+	}
+
+	Init()
+	defer Shutdown()
+
+	mesh, ok := LoadMesh(path)
+	if !ok {
+		t.Fatalf("can't load %s", path)
+	}
+	if !reflect.DeepEqual(mesh.Indices, indices) {
+		t.Errorf("indices %v, expected %v", mesh.Indices, indices)
+	}
+
+	// Buffers keep their references into the mapping while the renderer
+	// uploads them, and the mesh keeps its own until DestroyMesh.
+	Frame()
+	Frame()
+	if !fileMapped(t, path) {
+		t.Fatalf("mesh file unmapped before DestroyMesh")
+	}
+
+	DestroyMesh(&mesh)
+	Frame()
+	Frame()
+	switch {
+	case fileMapped(t, path):
+		t.Errorf("mesh file still mapped after DestroyMesh")
+	case mesh.Indices != nil || mesh.Vertices != nil:
+		t.Errorf("mesh data not cleared")
+	case mesh.VertexBuffer.h.idx != 0xffff || mesh.IndexBuffer.h.idx != 0xffff:
+		t.Errorf("mesh buffers not cleared")
+	}
+
+	// Second destroy must not release buffers or mapping again.
+	DestroyMesh(&mesh)
+	Frame()
+}
+
+func TestCalcVertexBounds(t *testing.T) {
+	decl := newVertexDecl([]vertexAttrib{
+		{AttribNormal, 4, AttribTypeUint8, true, true},
+		{AttribPosition, 3, AttribTypeHalf, false, false},
+	})
+	stride := decl.Stride()
+
+	// More vertices than BGFX_CONFIG_VERTEX_CHUNK_SIZE exercise threads.
+	const num = 40000
+	rng := rand.New(rand.NewSource(1))
+	vertices, _ := newVertices(stride, num)
+	min := [3]float32{math.MaxFloat32, math.MaxFloat32, math.MaxFloat32}
+	max := [3]float32{-math.MaxFloat32, -math.MaxFloat32, -math.MaxFloat32}
+	positions := make([][4]float32, num)
+	for ii := range positions {
+		VertexPack([4]float32{rng.Float32()*4 - 1, rng.Float32()*2 + 3, rng.Float32() - 8}, false, AttribPosition, decl, vertices, ii)
+		positions[ii] = VertexUnpack(AttribPosition, decl, vertices, ii)
+		for jj := range min {
+			min[jj] = float32(math.Min(float64(min[jj]), float64(positions[ii][jj])))
+			max[jj] = float32(math.Max(float64(max[jj]), float64(positions[ii][jj])))
+		}
+	}
+	var center [3]float32
+	for jj := range center {
+		center[jj] = (min[jj] + max[jj]) * 0.5
+	}
+	var radius float64
+	for _, pos := range positions {
+		var sq float64
+		for jj := range center {
+			sq += float64(pos[jj]-center[jj]) * float64(pos[jj]-center[jj])
+		}
+		radius = math.Max(radius, math.Sqrt(sq))
+	}
+
+	bounds := CalcVertexBounds(decl, vertices)
+	switch {
+	case bounds.Min != min || bounds.Max != max:
+		t.Errorf("bounding box %v %v, expected %v %v", bounds.Min, bounds.Max, min, max)
+	case bounds.Center != center:
+		t.Errorf("center %v, expected %v", bounds.Center, center)
+	case math.Abs(float64(bounds.Radius)-radius) > 1e-5*radius:
+		t.Errorf("radius %v, expected %v", bounds.Radius, radius)
+	}
+
+	if empty := CalcVertexBounds(decl, reflect.ValueOf(vertices).Slice(0, 0).Interface()); empty != (VertexBounds{}) {
+		t.Errorf("bounds of no vertices %v, expected zero", empty)
+	}
+}
+
+func TestCalcTangents(t *testing.T) {
+	decl := newVertexDecl([]vertexAttrib{
+		{AttribPosition, 3, AttribTypeFloat, false, false},
+		{AttribNormal, 4, AttribTypeUint8, true, true},
+		{AttribTangent, 4, AttribTypeFloat, false, false},
+		{AttribBitangent, 3, AttribTypeFloat, false, false},
+		{AttribTexcoord0, 2, AttribTypeFloat, false, false},
+	})
+	stride := decl.Stride()
+
+	// Wavy grid in xy plane, left half has texture mirrored in u.
+	const size = 200
+	vertices, _ := newVertices(stride, (size+1)*(size+1))
+	for y := 0; y <= size; y++ {
+		for x := 0; x <= size; x++ {
+			fx, fy := float32(x)/size, float32(y)/size
+			slope := 0.3 * math.Cos(float64(fx)*20)
+			z := float32(0.015 * math.Sin(float64(fx)*20))
+			nx, nz := -slope, 1.0
+			nlen := math.Sqrt(nx*nx + nz*nz)
+			u := fx - 0.5
+			if x < size/2 {
+				u = -u
+			}
+			ii := y*(size+1) + x
+			VertexPack([4]float32{fx, fy, z}, false, AttribPosition, decl, vertices, ii)
+			VertexPack([4]float32{float32(nx / nlen), 0, float32(nz / nlen)}, true, AttribNormal, decl, vertices, ii)
+			VertexPack([4]float32{u, fy}, false, AttribTexcoord0, decl, vertices, ii)
+		}
+	}
+	var indices []uint16
+	for y := 0; y < size; y++ {
+		for x := 0; x < size; x++ {
+			v := uint16(y*(size+1) + x)
+			indices = append(indices, v, v+1, v+size+1, v+1, v+size+2, v+size+1)
+		}
+	}
+
+	CalcTangents(vertices, decl, indices)
+
+	for y := 0; y <= size; y++ {
+		for x := 0; x <= size; x++ {
+			if x == size/2 {
+				// Vertices on mirror seam have no defined tangent.
+				continue
+			}
+			ii := y*(size+1) + x
+			normal := VertexUnpack(AttribNormal, decl, vertices, ii)
+			tangent := VertexUnpack(AttribTangent, decl, vertices, ii)
+			bitangent := VertexUnpack(AttribBitangent, decl, vertices, ii)
+
+			w := float32(1)
+			if x < size/2 {
+				w = -1
+			}
+			var dot, length float32
+			for jj := 0; jj < 3; jj++ {
+				dot += tangent[jj] * normal[jj]
+				length += tangent[jj] * tangent[jj]
+			}
+			cross := [3]float32{
+				(normal[1]*tangent[2] - normal[2]*tangent[1]) * tangent[3],
+				(normal[2]*tangent[0] - normal[0]*tangent[2]) * tangent[3],
+				(normal[0]*tangent[1] - normal[1]*tangent[0]) * tangent[3],
+			}
+			switch {
+			case tangent[3] != w:
+				t.Fatalf("vertex %d handedness %v, expected %v", ii, tangent[3], w)
+			case math.Abs(float64(dot)) > 0.02 || math.Abs(float64(length)-1) > 1e-4:
+				t.Fatalf("vertex %d tangent %v isn't unit and orthogonal to normal %v", ii, tangent, normal)
+			case w*tangent[0] < 0.9 || math.Abs(float64(tangent[1])) > 1e-3:
+				t.Fatalf("vertex %d tangent %v doesn't follow u", ii, tangent)
+			case math.Abs(float64(bitangent[0]-cross[0])) > 0.02 ||
+				math.Abs(float64(bitangent[1]-cross[1])) > 0.02 ||
+				math.Abs(float64(bitangent[2]-cross[2])) > 0.02:
+				t.Fatalf("vertex %d bitangent %v, expected %v", ii, bitangent, cross)
+			case bitangent[1] < 0.9:
+				t.Fatalf("vertex %d bitangent %v doesn't follow v", ii, bitangent)
+			}
+		}
+	}
+}